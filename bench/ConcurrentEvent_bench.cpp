@@ -0,0 +1,76 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentEvent.hpp>
+#include <signals/ConcurrentSignal.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+constexpr auto slots = 4;
+
+struct BenchmarkEvent : signals::ConcurrentEvent<BenchmarkEvent, void(int)>
+{
+};
+
+signals::ConcurrentSignal<void(int)> unsharded;
+
+// Slots without shared state, so that only the emission itself can contend
+void consume(int i)
+{
+    benchmark::DoNotOptimize(i);
+}
+
+// Subscribe once, on first use from whichever thread gets here first
+void subscribe()
+{
+    static const auto subscribed = [] {
+        for (auto i = 0; i < slots; ++i)
+        {
+            BenchmarkEvent::subscribe(&consume);
+            unsharded.connect(&consume);
+        }
+
+        return true;
+    }();
+    benchmark::DoNotOptimize(subscribed);
+}
+
+void threadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const auto hardware = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+
+    for (auto threads = 1; threads < hardware; threads *= 2)
+        benchmark->Threads(threads);
+
+    benchmark->Threads(hardware);
+}
+
+// Each thread registers as a reader in a shard of its own, so the threads share no counter
+void fireEvent(benchmark::State& state)
+{
+    const auto event = BenchmarkEvent{};
+    subscribe();
+
+    for (auto _ : state)
+        event(1);
+
+    state.SetItemsProcessed(state.iterations() * slots);
+}
+BENCHMARK(fireEvent)->Apply(threadCounts)->UseRealTime();
+
+// Compare with fireEvent, all threads register as readers on the same cache line
+void emitUnsharded(benchmark::State& state)
+{
+    subscribe();
+
+    for (auto _ : state)
+        unsharded(1);
+
+    state.SetItemsProcessed(state.iterations() * slots);
+}
+BENCHMARK(emitUnsharded)->Apply(threadCounts)->UseRealTime();
+
+} // namespace
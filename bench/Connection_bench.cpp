@@ -0,0 +1,114 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConnectionGroup.hpp>
+#include <signals/ScopedConnection.hpp>
+#include <signals/Signal.hpp>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace
+{
+
+void connected(benchmark::State& state)
+{
+    auto signal = signals::Signal<void()>{};
+    const auto connection = signal.connect([] {});
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(connection.connected());
+}
+BENCHMARK(connected);
+
+void disconnect(benchmark::State& state)
+{
+    auto signal = signals::Signal<void()>{};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto connection = signal.connect([] {});
+        state.ResumeTiming();
+
+        connection.disconnect();
+    }
+}
+BENCHMARK(disconnect);
+
+void scopedConnectionLifetime(benchmark::State& state)
+{
+    auto signal = signals::Signal<void()>{};
+
+    for (auto _ : state)
+    {
+        const signals::ScopedConnection connection = signal.connect([] {});
+        benchmark::DoNotOptimize(&connection);
+    }
+}
+BENCHMARK(scopedConnectionLifetime);
+
+// Session teardown: the connections of a session are spread over several signals, each of
+// which removes its disconnected slots once before it is next connected to
+constexpr auto sessionSignals = std::size_t{16};
+
+void reconnect(std::vector<signals::Signal<void()>>& signals)
+{
+    for (auto& signal : signals)
+        signal.connect([] {}).disconnect();
+}
+
+void disconnectScopedConnections(benchmark::State& state)
+{
+    auto signals = std::vector<signals::Signal<void()>>(sessionSignals);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto connections = std::vector<signals::ScopedConnection>{};
+
+        for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+            connections.emplace_back(signals[i % sessionSignals].connect([] {}));
+        state.ResumeTiming();
+
+        connections.clear();
+        reconnect(signals);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(disconnectScopedConnections)->Arg(256);
+
+void disconnectConnectionGroup(benchmark::State& state)
+{
+    auto signals = std::vector<signals::Signal<void()>>(sessionSignals);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto group = signals::ConnectionGroup{};
+
+        for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+            group.add(signals[i % sessionSignals].connect([] {}));
+        state.ResumeTiming();
+
+        group.disconnect();
+        reconnect(signals);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(disconnectConnectionGroup)->Arg(256);
+
+void copyConnection(benchmark::State& state)
+{
+    auto signal = signals::Signal<void()>{};
+    const auto connection = signal.connect([] {});
+
+    for (auto _ : state)
+    {
+        auto copy = connection;
+        benchmark::DoNotOptimize(&copy);
+    }
+}
+BENCHMARK(copyConnection);
+
+} // namespace
@@ -0,0 +1,35 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/EventDispatcher.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+
+void publish(benchmark::State& state)
+{
+    auto dispatcher = signals::EventDispatcher<std::int64_t, void(int)>{};
+    auto sum = 0;
+
+    for (auto key = std::int64_t{0}; key < state.range(0); ++key)
+        dispatcher.subscribe(key, [&sum](int i) {
+            sum += i;
+        });
+
+    auto key = std::int64_t{0};
+
+    for (auto _ : state)
+    {
+        dispatcher(key, 1);
+        benchmark::DoNotOptimize(sum);
+
+        if (++key == state.range(0))
+            key = 0;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(publish)->Arg(16)->Arg(2000);
+
+} // namespace
@@ -0,0 +1,99 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ParallelCombiner.hpp>
+#include <signals/Signal.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace
+{
+
+constexpr auto slots = 64;
+
+std::unique_ptr<signals::ThreadPool> pool;
+
+template<typename Combiner>
+using Signal = signals::Signal<double(double), Combiner>;
+
+struct BenchmarkPool
+{
+    signals::ThreadPool& operator()() const
+    {
+        return *pool;
+    }
+};
+
+// Number of pool threads, the emitting thread takes part in the emission too
+void threadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const auto hardware = std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (auto threads = 1u; threads < hardware; threads *= 2)
+        benchmark->Arg(threads);
+
+    benchmark->Arg(hardware);
+}
+
+// CPU-heavy slot taking a few microseconds
+double work(double x)
+{
+    for (auto i = 0; i < 1000; ++i)
+        x = std::sqrt(x + i);
+
+    return x;
+}
+
+template<typename Signal>
+void connect(Signal& signal)
+{
+    for (auto i = 0; i < slots; ++i)
+        signal.connect(&work);
+}
+
+void emitSerial(benchmark::State& state)
+{
+    auto signal = Signal<signals::DefaultCombiner<double>>{};
+    connect(signal);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(signal(1.0));
+
+    state.SetItemsProcessed(state.iterations() * slots);
+}
+BENCHMARK(emitSerial)->UseRealTime();
+
+// The work is done by the pool threads and the emitting thread,
+// so compare the real time with that of the serial emission
+void emitParallel(benchmark::State& state)
+{
+    pool = std::make_unique<signals::ThreadPool>(static_cast<std::size_t>(state.range(0)));
+    auto signal = Signal<signals::ParallelCombiner<double, BenchmarkPool>>{};
+    connect(signal);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(signal(1.0));
+
+    state.SetItemsProcessed(state.iterations() * slots);
+    pool.reset();
+}
+BENCHMARK(emitParallel)->Apply(threadCounts)->UseRealTime();
+
+void emitParallelReduce(benchmark::State& state)
+{
+    pool = std::make_unique<signals::ThreadPool>(static_cast<std::size_t>(state.range(0)));
+    using Reduce = signals::ParallelReduceCombiner<double, std::plus<>, BenchmarkPool>;
+    auto signal = Signal<Reduce>{};
+    connect(signal);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(signal(1.0));
+
+    state.SetItemsProcessed(state.iterations() * slots);
+    pool.reset();
+}
+BENCHMARK(emitParallelReduce)->Apply(threadCounts)->UseRealTime();
+
+} // namespace
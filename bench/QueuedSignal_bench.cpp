@@ -0,0 +1,56 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/QueuedSignal.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <span>
+
+namespace
+{
+
+// Events queued and then drained in batches of the argument
+void emitAndDrainQueued(benchmark::State& state)
+{
+    auto signal = signals::QueuedSignal<void(double), 1024>{};
+    auto sum = 0.0;
+    signal.connect([&sum](double price) {
+        sum += price;
+    });
+
+    for (auto _ : state)
+    {
+        for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+            signal(1.0);
+
+        signal.drain();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitAndDrainQueued)->Arg(1)->Arg(1024);
+
+// Same events drained to a slot taking the whole batch
+void emitAndDrainQueuedBatches(benchmark::State& state)
+{
+    auto signal = signals::QueuedSignal<void(double), 1024>{};
+    auto sum = 0.0;
+    signal.connect([&sum](std::span<const double> prices) {
+        for (const auto price : prices)
+            sum += price;
+    });
+
+    for (auto _ : state)
+    {
+        for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+            signal(1.0);
+
+        signal.drain();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitAndDrainQueuedBatches)->Arg(1)->Arg(1024);
+
+} // namespace
@@ -0,0 +1,240 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/Signal.hpp>
+#include <signals/StaticSignal.hpp>
+#include <benchmark/benchmark.h>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+void slotCounts(benchmark::internal::Benchmark* benchmark)
+{
+    for (const auto slots : {0, 1, 8, 64, 1024})
+        benchmark->Arg(slots);
+}
+
+template<typename Signal, typename Fn>
+auto connect(Signal& signal, std::int64_t slots, Fn fn)
+{
+    auto connections = std::vector<signals::Connection>{};
+
+    for (auto i = std::int64_t{0}; i < slots; ++i)
+        connections.push_back(signal.connect(fn));
+
+    return connections;
+}
+
+void emitVoid(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto sum = 0;
+
+    connect(signal, state.range(0), [&sum](int i) {
+        sum += i;
+    });
+
+    for (auto _ : state)
+    {
+        signal(1);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitVoid)->Apply(slotCounts);
+
+void emitValue(benchmark::State& state)
+{
+    auto signal = signals::Signal<int(int)>{};
+
+    connect(signal, state.range(0), [](int i) {
+        return i + 1;
+    });
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(signal(1));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitValue)->Apply(slotCounts);
+
+void emitInstrumented(benchmark::State& state)
+{
+    auto signal =
+        signals::Signal<void(int), signals::DefaultCombiner<void>, signals::EmissionMetrics>{};
+    auto sum = 0;
+
+    connect(signal, state.range(0), [&sum](int i) {
+        sum += i;
+    });
+
+    for (auto _ : state)
+    {
+        signal(1);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitInstrumented)->Apply(slotCounts);
+
+int staticSum = 0;
+
+void add(int i)
+{
+    staticSum += i;
+}
+
+// Compare with emitVoid/8
+void emitStatic(benchmark::State& state)
+{
+    const auto signal =
+        signals::StaticSignal<void(int), &add, &add, &add, &add, &add, &add, &add, &add>{};
+
+    for (auto _ : state)
+    {
+        signal(1);
+        benchmark::DoNotOptimize(staticSum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * signal.num_slots());
+}
+BENCHMARK(emitStatic);
+
+void emitWithDisconnectedSlots(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto sum = 0;
+
+    // Every other slot is disconnected but not yet removed
+    auto connections = connect(signal, state.range(0), [&sum](int i) {
+        sum += i;
+    });
+
+    for (auto i = std::size_t{0}; i < connections.size(); i += 2)
+        connections[i].disconnect();
+
+    for (auto _ : state)
+    {
+        signal(1);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitWithDisconnectedSlots)->Apply(slotCounts);
+
+constexpr auto batchSize = 1024;
+
+void emitEachOfBatch(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto sum = 0;
+    const auto events = std::vector<int>(batchSize, 1);
+
+    connect(signal, state.range(0), [&sum](int i) {
+        sum += i;
+    });
+
+    for (auto _ : state)
+    {
+        for (const auto event : events)
+            signal(event);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * batchSize);
+}
+BENCHMARK(emitEachOfBatch)->Apply(slotCounts);
+
+void emitBatch(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto sum = 0;
+    const auto events = std::vector<int>(batchSize, 1);
+
+    connect(signal, state.range(0), [&sum](int i) {
+        sum += i;
+    });
+
+    for (auto _ : state)
+    {
+        signal.emit_batch(events);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * batchSize);
+}
+BENCHMARK(emitBatch)->Apply(slotCounts);
+
+void emitBatchToBatchSlots(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto sum = 0;
+    const auto events = std::vector<int>(batchSize, 1);
+
+    connect(signal, state.range(0), [&sum](std::span<const int> batch) {
+        for (const auto i : batch)
+            sum += i;
+    });
+
+    for (auto _ : state)
+    {
+        signal.emit_batch(events);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * batchSize);
+}
+BENCHMARK(emitBatchToBatchSlots)->Apply(slotCounts);
+
+void connectAndDisconnect(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+    const auto connections = connect(signal, state.range(0), [](int) {});
+
+    for (auto _ : state)
+    {
+        auto connection = signal.connect([](int) {});
+        connection.disconnect();
+    }
+}
+BENCHMARK(connectAndDisconnect)->Apply(slotCounts);
+
+// Connect to the first of many groups, which moves every slot of the other groups
+void connectToFirstGroup(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+
+    for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+        signal.connect(static_cast<int>(i % 16), [](int) {});
+
+    for (auto _ : state)
+    {
+        auto connection = signal.connect(-1, [](int) {});
+        connection.disconnect();
+    }
+}
+BENCHMARK(connectToFirstGroup)->Apply(slotCounts);
+
+void connectAfterDisconnectingAll(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(int)>{};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (auto& connection : connect(signal, state.range(0), [](int) {}))
+            connection.disconnect();
+        state.ResumeTiming();
+
+        // Removes all the disconnected slots
+        signal.connect([](int) {});
+    }
+}
+BENCHMARK(connectAfterDisconnectingAll)->Apply(slotCounts);
+
+} // namespace
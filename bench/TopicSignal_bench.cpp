@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/TopicSignal.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Topics subscribed to by one slot each, one of which is emitted
+void emitTopic(benchmark::State& state)
+{
+    auto signal = signals::TopicSignal<void(double)>{};
+    auto sum = 0.0;
+    auto topics = std::vector<std::string>{};
+
+    for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+    {
+        topics.push_back("SYM" + std::to_string(i));
+        signal.connect(topics.back(), [&sum](double price) {
+            sum += price;
+        });
+    }
+
+    auto i = std::size_t{0};
+
+    for (auto _ : state)
+    {
+        signal(topics[i], 1.0);
+        benchmark::DoNotOptimize(sum);
+
+        if (++i == topics.size())
+            i = 0;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(emitTopic)->Arg(16)->Arg(4096);
+
+// Same slots filtering the topic themselves, for comparison
+void emitFilteredInSlots(benchmark::State& state)
+{
+    auto signal = signals::Signal<void(const std::string&, double)>{};
+    auto sum = 0.0;
+    auto topics = std::vector<std::string>{};
+
+    for (auto i = std::int64_t{0}; i < state.range(0); ++i)
+    {
+        topics.push_back("SYM" + std::to_string(i));
+        signal.connect([&sum, topic = topics.back()](const std::string& t, double price) {
+            if (t == topic)
+                sum += price;
+        });
+    }
+
+    auto i = std::size_t{0};
+
+    for (auto _ : state)
+    {
+        signal(topics[i], 1.0);
+        benchmark::DoNotOptimize(sum);
+
+        if (++i == topics.size())
+            i = 0;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(emitFilteredInSlots)->Arg(16)->Arg(4096);
+
+} // namespace
@@ -0,0 +1,16 @@
+cmake_minimum_required(VERSION 3.11)
+include_guard(GLOBAL)
+include(FetchContent)
+
+FetchContent_Declare(benchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG        344117638c8ff7e239044fd0fa7085839fc03021)
+
+FetchContent_GetProperties(benchmark)
+
+if(NOT benchmark_POPULATED)
+    FetchContent_Populate(benchmark)
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    add_subdirectory(${benchmark_SOURCE_DIR} ${benchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+endif()
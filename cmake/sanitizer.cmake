@@ -0,0 +1,21 @@
+# Build targets with a sanitizer by marking them with `add_sanitizer()`:
+#
+#   add_sanitizer(<target>)
+#
+# and configuring the project with the sanitizer to use, e.g.
+#
+#   $ cmake -S . -B build/ -DSANITIZER=thread
+#
+# NOTE! Only GNU and Clang compilers are supported
+
+cmake_minimum_required(VERSION 3.15)
+include_guard(GLOBAL)
+
+set(SANITIZER "" CACHE STRING "Sanitizer to build with (address, thread, undefined)")
+
+function(add_sanitizer target)
+    if(SANITIZER AND CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        target_compile_options(${target} PRIVATE -fsanitize=${SANITIZER} -fno-omit-frame-pointer -g)
+        target_link_options(${target} PUBLIC -fsanitize=${SANITIZER})
+    endif()
+endfunction()
@@ -0,0 +1,45 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_ARGUMENTS_HPP_
+#define SIGNALS_ARGUMENTS_HPP_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+// Type through which a parameter of type `T` is passed on without copying it:
+// objects by const reference, references as they are
+template<typename T>
+using Argument = std::conditional_t<std::is_reference_v<T>, T, const T&>;
+
+template<typename Signature>
+struct Arguments;
+
+// Conversion of the arguments of an emission to the parameter types of a signature
+//
+// Converting the arguments once before handing them to the slots keeps every slot
+// from converting or copying them again.
+template<typename R, typename... Args>
+struct Arguments<R(Args...)>
+{
+    // Call `fn` with the arguments shared by reference
+    template<typename Fn>
+    static decltype(auto) share(Fn&& fn, Argument<Args>... args)
+    {
+        return std::invoke(std::forward<Fn>(fn), std::forward<Argument<Args>>(args)...);
+    }
+
+    // Call `fn` with the arguments owned by the call and passed as rvalues
+    template<typename Fn>
+    static decltype(auto) own(Fn&& fn, Args... args)
+    {
+        return std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+    }
+};
+
+} // namespace signals
+
+#endif
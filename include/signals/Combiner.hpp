@@ -3,11 +3,21 @@
 #ifndef SIGNALS_COMBINER_HPP_
 #define SIGNALS_COMBINER_HPP_
 
+#include <cstddef>
 #include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace signals
 {
 
+// Combiner returning the result of the last slot
+//
+// Rvalue arguments are forwarded to the last slot, which can take their ownership.
+// The other slots get them as lvalues.
 template<typename R>
 struct DefaultCombiner
 {
@@ -16,8 +26,27 @@ struct DefaultCombiner
     {
         auto r = R{};
 
-        for (auto& slot : slots)
-            r = std::invoke(*slot, args...);
+        if constexpr ((std::is_lvalue_reference_v<Args> && ...))
+        {
+            for (auto& slot : slots)
+                r = std::invoke(*slot, args...);
+        }
+        else
+        {
+            for (auto it = std::ranges::begin(slots); it != std::ranges::end(slots);)
+            {
+                auto&& slot = *it;
+
+                if (++it == std::ranges::end(slots))
+                    return std::invoke(*slot, std::forward<Args>(args)...);
+
+                r = std::invoke(*slot, args...);
+
+                // The slot may have disconnected or blocked the one after it
+                if (!(*it)->enabled())
+                    ++it;
+            }
+        }
 
         return r;
     }
@@ -28,9 +57,128 @@ struct DefaultCombiner<void>
 {
     template<typename Slots, typename... Args>
     void operator()(Slots slots, Args&&... args) const
+    {
+        if constexpr ((std::is_lvalue_reference_v<Args> && ...))
+        {
+            for (auto& slot : slots)
+                std::invoke(*slot, args...);
+        }
+        else
+        {
+            for (auto it = std::ranges::begin(slots); it != std::ranges::end(slots);)
+            {
+                auto&& slot = *it;
+
+                if (++it == std::ranges::end(slots))
+                    return std::invoke(*slot, std::forward<Args>(args)...);
+
+                std::invoke(*slot, args...);
+
+                // The slot may have disconnected or blocked the one after it
+                if (!(*it)->enabled())
+                    ++it;
+            }
+        }
+    }
+};
+
+// Combiner returning whether any slot returned true, stops at the first that did
+struct AnyOf
+{
+    template<typename Slots, typename... Args>
+    bool operator()(Slots slots, Args&&... args) const
+    {
+        for (auto& slot : slots)
+            if (std::invoke(*slot, args...))
+                return true;
+
+        return false;
+    }
+};
+
+// Combiner returning whether all slots returned true, stops at the first that did not
+struct AllOf
+{
+    template<typename Slots, typename... Args>
+    bool operator()(Slots slots, Args&&... args) const
+    {
+        for (auto& slot : slots)
+            if (!std::invoke(*slot, args...))
+                return false;
+
+        return true;
+    }
+};
+
+// Combiner returning the first result that converts to true, such as an optional with a
+// value, and stops there. Returns an empty result if there is none.
+template<typename R>
+struct FirstNonEmpty
+{
+    template<typename Slots, typename... Args>
+    R operator()(Slots slots, Args&&... args) const
     {
         for (auto& slot : slots)
-            std::invoke(*slot, args...);
+            if (auto r = R{std::invoke(*slot, args...)}; r)
+                return r;
+
+        return R{};
+    }
+};
+
+// Combiner folding the results of all slots in order, starting from a value-initialized one
+template<typename R, typename Operation = std::plus<R>>
+struct Accumulate
+{
+    template<typename Slots, typename... Args>
+    R operator()(Slots slots, Args&&... args) const
+    {
+        auto r = R{};
+
+        for (auto& slot : slots)
+            r = std::invoke(Operation{}, std::move(r), std::invoke(*slot, args...));
+
+        return r;
+    }
+};
+
+// Combiner collecting the results into the span returned by `Buffer{}()` and stopping when
+// it is full. Returns the part of the span collected into.
+template<typename R, typename Buffer>
+struct CollectInto
+{
+    template<typename Slots, typename... Args>
+    std::span<R> operator()(Slots slots, Args&&... args) const
+    {
+        const auto buffer = std::span<R>{std::invoke(Buffer{})};
+        auto collected = std::size_t{0};
+
+        for (auto it = std::ranges::begin(slots);
+             collected < buffer.size() && it != std::ranges::end(slots); ++it)
+            buffer[collected++] = std::invoke(**it, args...);
+
+        return buffer.first(collected);
+    }
+};
+
+// Combiner returning the first of the greatest results, or nothing if there are no slots
+template<typename R, typename Compare = std::less<R>>
+struct MaxElement
+{
+    template<typename Slots, typename... Args>
+    std::optional<R> operator()(Slots slots, Args&&... args) const
+    {
+        auto max = std::optional<R>{};
+
+        for (auto& slot : slots)
+        {
+            auto r = R{std::invoke(*slot, args...)};
+
+            if (!max || std::invoke(Compare{}, *max, r))
+                max = std::move(r);
+        }
+
+        return max;
     }
 };
 
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_CONCURRENTEVENT_HPP_
+#define SIGNALS_CONCURRENTEVENT_HPP_
+
+#include "ConcurrentSignal.hpp"
+#include <cstddef>
+
+namespace signals
+{
+
+// Event that can be subscribed to and fired from any thread
+//
+// Firing is lock-free and the emitting threads register in separate cache lines,
+// so that firing the same event from many threads scales with the number of cores.
+template<
+    typename T, typename Signature,
+    typename Combiner = DefaultCombiner<typename ConcurrentSlot<Signature>::Result>>
+class ConcurrentEvent
+{
+public:
+    template<typename Fn>
+    static auto subscribe(Fn&& fn);
+
+    template<typename... Args>
+    auto operator()(Args&&... args) const;
+
+private:
+    static constexpr std::size_t readerShards = 32;
+
+    static inline ConcurrentSignal<Signature, Combiner, readerShards> signal;
+};
+
+template<typename T, typename Signature, typename Combiner>
+template<typename Fn>
+inline auto ConcurrentEvent<T, Signature, Combiner>::subscribe(Fn&& fn)
+{
+    return signal.connect(std::forward<Fn>(fn));
+}
+
+template<typename T, typename Signature, typename Combiner>
+template<typename... Args>
+inline auto ConcurrentEvent<T, Signature, Combiner>::operator()(Args&&... args) const
+{
+    return std::invoke(signal, std::forward<Args>(args)...);
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,157 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_CONCURRENTSIGNAL_HPP_
+#define SIGNALS_CONCURRENTSIGNAL_HPP_
+
+#include "Combiner.hpp"
+#include "ConcurrentSlot.hpp"
+#include "Connection.hpp"
+#include "Rcu.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <ranges>
+#include <vector>
+
+namespace signals
+{
+
+// Signal that can be emitted, connected to and disconnected from any thread.
+//
+// Emission is lock-free: it reads an immutable snapshot of the slots published with
+// read-copy-update. Connecting and clearing take a lock and publish a new snapshot.
+// Disconnecting a slot only marks it disconnected, it is removed on the next connect.
+//
+// Emissions register in one of `ReaderShards` cache lines picked by the emitting thread.
+// More shards let emissions from many threads scale at the cost of a larger signal.
+template<
+    typename Signature,
+    typename Combiner = DefaultCombiner<typename ConcurrentSlot<Signature>::Result>,
+    std::size_t ReaderShards = 1>
+class ConcurrentSignal
+{
+public:
+    using Slot = signals::ConcurrentSlot<Signature>;
+
+    ConcurrentSignal() = default;
+
+    ConcurrentSignal(const ConcurrentSignal&) = delete;
+
+    ConcurrentSignal(ConcurrentSignal&&) = delete;
+
+    ~ConcurrentSignal() = default;
+
+    ConcurrentSignal& operator=(const ConcurrentSignal&) = delete;
+
+    ConcurrentSignal& operator=(ConcurrentSignal&&) = delete;
+
+    void clear();
+
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] auto num_slots() const;
+
+    template<typename Fn>
+    auto connect(Fn&& fn);
+
+    // Emit passing the arguments to the slots by const reference, converted once
+    template<typename... Args>
+    auto operator()(Args&&... args) const;
+
+    // Emit passing the arguments to the combiner as rvalues. The default combiner moves
+    // them to the last slot, which saves a copy for a last slot taking them by value.
+    template<typename... Args>
+    auto emit_moving(Args&&... args) const;
+
+private:
+    using Slots = std::vector<std::shared_ptr<Slot>>;
+
+    template<typename... Args>
+    auto emit(Args&&... args) const;
+
+    std::mutex mutex;
+    Rcu<Slots, ReaderShards> slots;
+};
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+void ConcurrentSignal<Signature, Combiner, ReaderShards>::clear()
+{
+    const auto lock = std::scoped_lock{mutex};
+
+    for (auto& slot : slots.current())
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    slots.update(std::make_unique<const Slots>());
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+bool ConcurrentSignal<Signature, Combiner, ReaderShards>::empty() const
+{
+    return slots.read([](const Slots& slots) {
+        return std::ranges::none_of(slots, std::mem_fn(&Slot::connected));
+    });
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+auto ConcurrentSignal<Signature, Combiner, ReaderShards>::num_slots() const
+{
+    return slots.read([](const Slots& slots) {
+        return std::ranges::count_if(slots, std::mem_fn(&Slot::connected));
+    });
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+template<typename Fn>
+auto ConcurrentSignal<Signature, Combiner, ReaderShards>::connect(Fn&& fn)
+{
+    const auto lock = std::scoped_lock{mutex};
+    const auto& current = slots.current();
+
+    auto next = std::make_unique<Slots>();
+    next->reserve(current.size() + 1);
+    std::ranges::copy_if(current, std::back_inserter(*next), std::mem_fn(&Slot::connected));
+
+    auto connection =
+        Connection{next->emplace_back(std::make_shared<Slot>(std::forward<Fn>(fn)))};
+    slots.update(std::move(next));
+    return connection;
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+template<typename... Args>
+inline auto ConcurrentSignal<Signature, Combiner, ReaderShards>::operator()(
+    Args&&... args) const
+{
+    return Arguments<Signature>::share(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+template<typename... Args>
+inline auto ConcurrentSignal<Signature, Combiner, ReaderShards>::emit_moving(
+    Args&&... args) const
+{
+    return Arguments<Signature>::own(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
+}
+
+template<typename Signature, typename Combiner, std::size_t ReaderShards>
+template<typename... Args>
+inline auto ConcurrentSignal<Signature, Combiner, ReaderShards>::emit(Args&&... args) const
+{
+    return slots.read([&](const Slots& immutable) {
+        return std::invoke(
+            Combiner{}, immutable | std::views::filter(std::mem_fn(&Slot::enabled)),
+            std::forward<Args>(args)...);
+    });
+}
+
+} // namespace signals
+
+#endif
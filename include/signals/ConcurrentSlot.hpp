@@ -0,0 +1,164 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_CONCURRENTSLOT_HPP_
+#define SIGNALS_CONCURRENTSLOT_HPP_
+
+#include "Disconnectable.hpp"
+#include "Function.hpp"
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace signals
+{
+
+template<typename>
+class ConcurrentSlot;
+
+namespace detail
+{
+
+// Targets that are told when their slot is disconnected, such as Queued, which then drops
+// the calls it has posted but not yet run
+template<typename Fn>
+concept CancellableTarget = std::is_copy_constructible_v<Fn> && requires(const Fn& fn) {
+    fn.cancel();
+};
+
+} // namespace detail
+
+// Slot that can be disconnected while it is being invoked from another thread.
+// The callable is never modified after construction, it is destroyed with the slot.
+// A target that can be cancelled is cancelled when the slot is disconnected.
+template<typename R, typename... Args>
+class ConcurrentSlot<R(Args...)> : public Disconnectable
+{
+public:
+    using Callable = Function<R(Args...)>;
+
+    using Result = R;
+
+    template<typename Fn>
+        requires std::is_constructible_v<Callable, Fn>
+    explicit ConcurrentSlot(Fn&& fn);
+
+    ConcurrentSlot(const ConcurrentSlot&) = delete;
+
+    ConcurrentSlot(ConcurrentSlot&&) = delete;
+
+    ~ConcurrentSlot() override = default;
+
+    ConcurrentSlot& operator=(const ConcurrentSlot&) = delete;
+
+    ConcurrentSlot& operator=(ConcurrentSlot&&) = delete;
+
+    R operator()(Argument<Args>... args) const;
+
+    // Call moving the arguments to the callable, for example when this is the last slot
+    R operator()(Args&&... args) const
+        requires(std::is_object_v<Args> || ...);
+
+    [[nodiscard]] bool connected() const override;
+
+    [[nodiscard]] bool blocked() const override;
+
+    // Whether the slot is connected and not blocked, that is, invoked when emitting
+    [[nodiscard]] bool enabled() const;
+
+private:
+    template<typename Fn>
+    static Function<void()> cancellation(const Fn& fn);
+
+    void disconnect() override;
+
+    void block() override;
+
+    void unblock() override;
+
+    const Function<void()> cancel;
+    const Callable callable;
+    std::atomic<bool> isConnected;
+    std::atomic<std::size_t> blocks = 0;
+};
+
+template<typename R, typename... Args>
+template<typename Fn>
+    requires std::is_constructible_v<typename ConcurrentSlot<R(Args...)>::Callable, Fn>
+ConcurrentSlot<R(Args...)>::ConcurrentSlot(Fn&& fn) :
+    cancel(cancellation(fn)),
+    callable(std::forward<Fn>(fn)),
+    isConnected(this->callable != nullptr)
+{
+}
+
+template<typename R, typename... Args>
+bool ConcurrentSlot<R(Args...)>::connected() const
+{
+    return isConnected.load(std::memory_order_acquire);
+}
+
+template<typename R, typename... Args>
+bool ConcurrentSlot<R(Args...)>::blocked() const
+{
+    return blocks.load(std::memory_order_acquire) != 0;
+}
+
+template<typename R, typename... Args>
+inline bool ConcurrentSlot<R(Args...)>::enabled() const
+{
+    return connected() && !blocked();
+}
+
+template<typename R, typename... Args>
+template<typename Fn>
+Function<void()> ConcurrentSlot<R(Args...)>::cancellation(const Fn& fn)
+{
+    if constexpr (detail::CancellableTarget<std::decay_t<Fn>>)
+        return [target = std::decay_t<Fn>{fn}] { target.cancel(); };
+    else
+        return nullptr;
+}
+
+template<typename R, typename... Args>
+void ConcurrentSlot<R(Args...)>::disconnect()
+{
+    // The callable may still be running on another thread, so it is cancelled instead of
+    // destroyed
+    if (isConnected.exchange(false, std::memory_order_acq_rel) && cancel)
+        cancel();
+}
+
+template<typename R, typename... Args>
+void ConcurrentSlot<R(Args...)>::block()
+{
+    blocks.fetch_add(1, std::memory_order_acq_rel);
+}
+
+template<typename R, typename... Args>
+void ConcurrentSlot<R(Args...)>::unblock()
+{
+    // Unblocking a slot that is not blocked does nothing
+    auto current = blocks.load(std::memory_order_acquire);
+
+    while (current != 0 &&
+           !blocks.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel))
+    {
+    }
+}
+
+template<typename R, typename... Args>
+R ConcurrentSlot<R(Args...)>::operator()(Argument<Args>... args) const
+{
+    return callable.call(std::forward<Argument<Args>>(args)...);
+}
+
+template<typename R, typename... Args>
+R ConcurrentSlot<R(Args...)>::operator()(Args&&... args) const
+    requires(std::is_object_v<Args> || ...)
+{
+    return std::invoke(callable, std::forward<Args>(args)...);
+}
+
+} // namespace signals
+
+#endif
@@ -4,7 +4,9 @@
 #define SIGNALS_CONNECTION_HPP_
 
 #include "Disconnectable.hpp"
+#include "SlotBase.hpp"
 #include <memory>
+#include <variant>
 
 namespace signals
 {
@@ -18,6 +20,8 @@ public:
 
     explicit Connection(const Disconnectable& slot) noexcept;
 
+    explicit Connection(SlotBase& slot) noexcept;
+
     Connection(const Connection&) = default;
 
     Connection(Connection&&) = default;
@@ -32,8 +36,33 @@ public:
 
     void disconnect();
 
+    // Keep the slot connected but stop invoking it until it is unblocked
+    void block();
+
+    void unblock();
+
+    bool blocked() const;
+
 private:
-    Disconnectable::weak_type slot;
+    friend class ConnectionGroup;
+
+    // Connection to the current generation of an intrusive slot, which does not keep the
+    // slot alive, as the slot may be in memory owned by its signal
+    struct Handle
+    {
+        [[nodiscard]] SlotBase* lock() const noexcept;
+
+        SlotBase::Reference slot;
+        SlotBase::Generation generation;
+    };
+
+    template<typename Fn>
+    void visit(Fn&& fn) const;
+
+    // The intrusive slot, or null if the slot is not intrusive or has been recycled
+    [[nodiscard]] SlotBase* intrusiveSlot() const noexcept;
+
+    std::variant<Disconnectable::weak_type, Handle> slot;
 };
 
 } // namespace signals
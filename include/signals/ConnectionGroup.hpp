@@ -0,0 +1,56 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_CONNECTIONGROUP_HPP_
+#define SIGNALS_CONNECTIONGROUP_HPP_
+
+#include "Connection.hpp"
+#include "ScopedConnection.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace signals
+{
+
+// Connections that are disconnected together when the group is destroyed
+//
+// The connections are stored contiguously. Disconnecting them groups the slots by their
+// signal, so that each signal disconnects its slots in one call and removes them once.
+// Connections to slots of other signals, such as a ConcurrentSignal, are disconnected one
+// by one.
+class ConnectionGroup
+{
+public:
+    ConnectionGroup() = default;
+
+    ConnectionGroup(const ConnectionGroup&) = delete;
+
+    ConnectionGroup(ConnectionGroup&&) = default;
+
+    ~ConnectionGroup();
+
+    ConnectionGroup& operator=(const ConnectionGroup&) = delete;
+
+    ConnectionGroup& operator=(ConnectionGroup&& other) noexcept;
+
+    void add(Connection connection);
+
+    // Take over the connection from the ScopedConnection
+    void add(ScopedConnection&& connection);
+
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+
+    // Disconnect all the connections and remove them from the group
+    void disconnect();
+
+    // Remove the connections from the group without disconnecting them
+    std::vector<Connection> release() noexcept;
+
+private:
+    std::vector<Connection> connections;
+};
+
+} // namespace signals
+
+#endif
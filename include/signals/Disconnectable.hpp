@@ -14,6 +14,22 @@ public:
     virtual bool connected() const = 0;
 
     virtual void disconnect() = 0;
+
+    // A blocked slot stays connected but is not invoked. It is blocked until it has been
+    // unblocked as many times as it was blocked. Slots that do not support blocking are
+    // never blocked.
+    virtual bool blocked() const
+    {
+        return false;
+    }
+
+    virtual void block()
+    {
+    }
+
+    virtual void unblock()
+    {
+    }
 };
 
 } // namespace signals
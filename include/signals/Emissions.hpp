@@ -0,0 +1,154 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_EMISSIONS_HPP_
+#define SIGNALS_EMISSIONS_HPP_
+
+#include "Executor.hpp"
+#include "ScopedConnection.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+// Successive emissions of a signal awaited one at a time by a coroutine
+//
+// Unlike `Signal::next()`, events emitted while the coroutine is not awaiting are queued,
+// so none is missed. The emissions are connected to as a slot, which is disconnected when
+// the emissions are destroyed. The queue is locked, so the coroutine can be resumed on an
+// executor running on another thread than the signal is emitted on.
+template<typename Signal>
+class Emissions
+{
+public:
+    using Event = typename Signal::Event;
+
+    class Awaiter;
+
+    static_assert(
+        std::is_void_v<typename Signal::Slot::Result>, "Awaited slots must return void");
+
+    explicit Emissions(Signal& signal);
+
+    // Emissions resuming the awaiting coroutine on the executor
+    Emissions(Signal& signal, Executor& executor);
+
+    Emissions(const Emissions&) = delete;
+
+    Emissions(Emissions&&) = delete;
+
+    ~Emissions() = default;
+
+    Emissions& operator=(const Emissions&) = delete;
+
+    Emissions& operator=(Emissions&&) = delete;
+
+    // Awaitable returning the oldest queued event, or the next one emitted
+    [[nodiscard]] Awaiter next() noexcept;
+
+    [[nodiscard]] std::size_t pending() const;
+
+private:
+    void push(Event event);
+
+    mutable std::mutex mutex;
+    std::deque<Event> events;
+    std::coroutine_handle<> awaiting;
+    Executor* executor = nullptr;
+    ScopedConnection connection;
+};
+
+template<typename Signal>
+class Emissions<Signal>::Awaiter
+{
+public:
+    explicit Awaiter(Emissions& emissions) noexcept :
+        emissions(emissions)
+    {
+    }
+
+    bool await_ready() const
+    {
+        return emissions.pending() != 0;
+    }
+
+    // Suspend unless an event has been queued since checking whether one is ready
+    bool await_suspend(std::coroutine_handle<> coroutine)
+    {
+        const auto lock = std::scoped_lock{emissions.mutex};
+
+        if (!emissions.events.empty())
+            return false;
+
+        emissions.awaiting = coroutine;
+        return true;
+    }
+
+    Event await_resume()
+    {
+        const auto lock = std::scoped_lock{emissions.mutex};
+        auto event = std::move(emissions.events.front());
+        emissions.events.pop_front();
+        return event;
+    }
+
+private:
+    Emissions& emissions;
+};
+
+template<typename Signal>
+Emissions<Signal>::Emissions(Signal& signal) :
+    connection(signal.connect([this](const auto&... args) {
+        push(Event{args...});
+    }))
+{
+}
+
+template<typename Signal>
+Emissions<Signal>::Emissions(Signal& signal, Executor& executor) :
+    Emissions(signal)
+{
+    this->executor = &executor;
+}
+
+template<typename Signal>
+auto Emissions<Signal>::next() noexcept -> Awaiter
+{
+    return Awaiter{*this};
+}
+
+template<typename Signal>
+std::size_t Emissions<Signal>::pending() const
+{
+    const auto lock = std::scoped_lock{mutex};
+    return events.size();
+}
+
+template<typename Signal>
+void Emissions<Signal>::push(Event event)
+{
+    auto coroutine = std::coroutine_handle<>{};
+    {
+        const auto lock = std::scoped_lock{mutex};
+        events.push_back(std::move(event));
+        coroutine = std::exchange(awaiting, {});
+    }
+
+    if (!coroutine)
+        return;
+
+    if (executor)
+        executor->post([coroutine] {
+            coroutine.resume();
+        });
+    else
+        coroutine.resume();
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_EVENTDISPATCHER_HPP_
+#define SIGNALS_EVENTDISPATCHER_HPP_
+
+#include "Signal.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace signals
+{
+
+// Events of the same signature told apart by a key known at run time, such as an enum,
+// a message id or a std::type_index
+//
+// Each key has a Signal of its own, found through an open addressing table of small buckets
+// probed linearly, so that publishing costs a hash and usually a single cache line before
+// emitting. The signals stay in place while keys are added, so keys can be subscribed to
+// while publishing.
+template<
+    typename Key, typename Signature,
+    typename Combiner = DefaultCombiner<typename Slot<Signature>::Result>,
+    typename Hash = std::hash<Key>>
+class EventDispatcher
+{
+public:
+    using Signal = signals::Signal<Signature, Combiner>;
+
+    EventDispatcher() = default;
+
+    EventDispatcher(const EventDispatcher&) = delete;
+
+    EventDispatcher(EventDispatcher&&) = default;
+
+    ~EventDispatcher() = default;
+
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+
+    EventDispatcher& operator=(EventDispatcher&&) = default;
+
+    // Number of keys that have been subscribed to
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    [[nodiscard]] bool empty(const Key& key) const;
+
+    template<typename Fn>
+    auto subscribe(const Key& key, Fn&& fn);
+
+    // Signal of the key, added if there is none. Moving a signal to it moves its
+    // subscriptions under the key, replacing those there.
+    [[nodiscard]] Signal& signal(const Key& key);
+
+    // Publish the event of the key, which without subscribers returns what an empty
+    // signal does
+    template<typename... Args>
+    auto operator()(const Key& key, Args&&... args) const;
+
+private:
+    struct Topic
+    {
+        Key key;
+        Signal signal;
+    };
+
+    // Low bits of the hash of the key and the index of its topic
+    struct Bucket
+    {
+        std::uint32_t fragment;
+        std::uint32_t topic;
+    };
+
+    static constexpr std::uint32_t none = UINT32_MAX;
+
+    static constexpr std::size_t minBuckets = 16;
+
+    [[nodiscard]] static std::uint64_t hash(const Key& key);
+
+    // Index of the topic of the key, or `none`
+    [[nodiscard]] std::uint32_t find(const Key& key) const;
+
+    void rehash(std::size_t bucketCount);
+
+    // Put the topic in the first free bucket from the home of its hash
+    void place(std::uint64_t hash, std::size_t topic) noexcept;
+
+    [[nodiscard]] std::size_t home(std::uint64_t hash) const noexcept;
+
+    std::deque<Topic> topics;
+    std::vector<Bucket> buckets;
+    Signal unsubscribed;
+};
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+std::size_t EventDispatcher<Key, Signature, Combiner, Hash>::size() const noexcept
+{
+    return topics.size();
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+bool EventDispatcher<Key, Signature, Combiner, Hash>::empty(const Key& key) const
+{
+    const auto topic = find(key);
+    return topic == none || topics[topic].signal.empty();
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+template<typename Fn>
+auto EventDispatcher<Key, Signature, Combiner, Hash>::subscribe(const Key& key, Fn&& fn)
+{
+    return signal(key).connect(std::forward<Fn>(fn));
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+auto EventDispatcher<Key, Signature, Combiner, Hash>::signal(const Key& key) -> Signal&
+{
+    if (const auto topic = find(key); topic != none)
+        return topics[topic].signal;
+
+    // At most half of the buckets are used, which keeps the probe sequences short
+    if (2 * (topics.size() + 1) > buckets.size())
+        rehash(std::max(minBuckets, 2 * buckets.size()));
+
+    auto& topic = topics.emplace_back(key, Signal{});
+    place(hash(key), topics.size() - 1);
+    return topic.signal;
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+template<typename... Args>
+inline auto EventDispatcher<Key, Signature, Combiner, Hash>::operator()(
+    const Key& key, Args&&... args) const
+{
+    const auto topic = find(key);
+    const auto& signal = topic != none ? topics[topic].signal : unsubscribed;
+    return std::invoke(signal, std::forward<Args>(args)...);
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+inline std::uint64_t EventDispatcher<Key, Signature, Combiner, Hash>::hash(const Key& key)
+{
+    // Fibonacci hashing spreads the identity hashes of consecutive integers over the table
+    return static_cast<std::uint64_t>(Hash{}(key)) * 0x9e3779b97f4a7c15;
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+inline std::uint32_t EventDispatcher<Key, Signature, Combiner, Hash>::find(
+    const Key& key) const
+{
+    if (buckets.empty())
+        return none;
+
+    const auto h = hash(key);
+    const auto fragment = static_cast<std::uint32_t>(h);
+
+    for (auto i = home(h);; i = (i + 1) & (buckets.size() - 1))
+    {
+        const auto& bucket = buckets[i];
+
+        if (bucket.topic == none ||
+            (bucket.fragment == fragment && topics[bucket.topic].key == key))
+            return bucket.topic;
+    }
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+void EventDispatcher<Key, Signature, Combiner, Hash>::rehash(std::size_t bucketCount)
+{
+    buckets.assign(bucketCount, Bucket{0, none});
+
+    for (auto topic = std::size_t{0}; topic < topics.size(); ++topic)
+        place(hash(topics[topic].key), topic);
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+void EventDispatcher<Key, Signature, Combiner, Hash>::place(
+    std::uint64_t hash, std::size_t topic) noexcept
+{
+    auto i = home(hash);
+
+    while (buckets[i].topic != none)
+        i = (i + 1) & (buckets.size() - 1);
+
+    buckets[i] = {static_cast<std::uint32_t>(hash), static_cast<std::uint32_t>(topic)};
+}
+
+template<typename Key, typename Signature, typename Combiner, typename Hash>
+inline std::size_t EventDispatcher<Key, Signature, Combiner, Hash>::home(
+    std::uint64_t hash) const noexcept
+{
+    // The high bits of a Fibonacci hash are the well mixed ones
+    return static_cast<std::size_t>(hash >> (64 - std::countr_zero(buckets.size())));
+}
+
+} // namespace signals
+
+#endif
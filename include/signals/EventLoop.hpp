@@ -0,0 +1,60 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_EVENTLOOP_HPP_
+#define SIGNALS_EVENTLOOP_HPP_
+
+#include "Executor.hpp"
+#include "MpscQueue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace signals
+{
+
+// Executor running the posted tasks on the thread that runs or polls the loop.
+// Tasks can be posted from any thread without locking.
+class EventLoop : public Executor
+{
+public:
+    EventLoop() = default;
+
+    // Event loop that can be found by its name while it exists
+    explicit EventLoop(std::string name);
+
+    EventLoop(const EventLoop&) = delete;
+
+    EventLoop(EventLoop&&) = delete;
+
+    ~EventLoop() override;
+
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    EventLoop& operator=(EventLoop&&) = delete;
+
+    [[nodiscard]] static EventLoop* find(std::string_view name);
+
+    [[nodiscard]] const std::string& name() const noexcept;
+
+    void post(Task task) override;
+
+    // Run the posted tasks until the loop is stopped
+    void run();
+
+    // Run the tasks posted before the call and return how many were run
+    std::size_t poll();
+
+    void stop();
+
+private:
+    MpscQueue<Task> tasks;
+    std::atomic<std::size_t> queued = 0;
+    std::atomic<std::size_t> posted = 0;
+    std::atomic<bool> stopped = false;
+    std::string loopName;
+};
+
+} // namespace signals
+
+#endif
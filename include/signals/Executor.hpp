@@ -0,0 +1,24 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_EXECUTOR_HPP_
+#define SIGNALS_EXECUTOR_HPP_
+
+#include "Function.hpp"
+
+namespace signals
+{
+
+class Executor
+{
+public:
+    // Room for a weak reference to a slot and a couple of arguments without allocating
+    using Task = Function<void(), 8 * sizeof(void*)>;
+
+    virtual ~Executor() = default;
+
+    virtual void post(Task task) = 0;
+};
+
+} // namespace signals
+
+#endif
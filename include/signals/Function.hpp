@@ -0,0 +1,354 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_FUNCTION_HPP_
+#define SIGNALS_FUNCTION_HPP_
+
+#include "Arguments.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+template<typename Signature, std::size_t Capacity = 4 * sizeof(void*)>
+class Function;
+
+namespace detail
+{
+
+// Targets callable also without owning the arguments, as the arguments they take by value
+// can be copied
+template<typename Fn, typename R, typename... Args>
+concept FunctionTarget = std::is_invocable_r_v<R, Fn&, Args...> &&
+    (std::is_invocable_r_v<R, Fn&, Argument<Args>...> ||
+     ((std::is_reference_v<Args> || std::is_copy_constructible_v<Args>) && ...));
+
+// Targets that can be empty, such as pointers and function wrappers, which are null when
+// they compare equal to nullptr
+template<typename Fn>
+concept NullableTarget = std::is_constructible_v<Fn, std::nullptr_t> &&
+    requires(const Fn& fn) {
+        { fn == nullptr } -> std::convertible_to<bool>;
+    };
+
+} // namespace detail
+
+// Move-only polymorphic function wrapper with an inline buffer
+//
+// Callables that fit into `Capacity` bytes and are nothrow move constructible are stored
+// inline, others are allocated from the memory resource of the allocator. A call is a single
+// indirect call through the stored invoker, which calls the target directly and can inline it.
+template<typename R, typename... Args, std::size_t Capacity>
+class Function<R(Args...), Capacity>
+{
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Function() noexcept = default;
+
+    Function(std::nullptr_t) noexcept;
+
+    template<typename Fn>
+        requires(
+            !std::is_same_v<std::remove_cvref_t<Fn>, Function> &&
+            detail::FunctionTarget<std::decay_t<Fn>, R, Args...>)
+    Function(Fn&& fn);
+
+    template<typename Fn>
+        requires(
+            !std::is_same_v<std::remove_cvref_t<Fn>, Function> &&
+            detail::FunctionTarget<std::decay_t<Fn>, R, Args...>)
+    Function(std::allocator_arg_t, const allocator_type& allocator, Fn&& fn);
+
+    Function(const Function&) = delete;
+
+    Function(Function&& other) noexcept;
+
+    ~Function();
+
+    Function& operator=(const Function&) = delete;
+
+    Function& operator=(Function&& other) noexcept;
+
+    Function& operator=(std::nullptr_t) noexcept;
+
+    R operator()(Args... args) const;
+
+    // Call the target without taking the ownership of the arguments. The arguments are
+    // copied only for a target that does not take them by const reference, so targets
+    // taking move-only arguments by value are not accepted.
+    R call(Argument<Args>... args) const;
+
+    explicit operator bool() const noexcept;
+
+    bool operator==(std::nullptr_t) const noexcept;
+
+    template<typename Fn>
+    static constexpr bool storedInline = sizeof(Fn) <= Capacity &&
+        alignof(Fn) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Fn>;
+
+private:
+    enum class Operation
+    {
+        Move,
+        Destroy
+    };
+
+    // Owned arguments can be moved to the target, others are passed by const reference
+    using Invoker = R (*)(void*, bool owned, Argument<Args>...);
+
+    using Manager = void (*)(Operation, void*, void*) noexcept;
+
+    // Callable allocated from the memory resource of the allocator
+    struct Allocated
+    {
+        void* target;
+        allocator_type allocator;
+    };
+
+    static_assert(Capacity >= sizeof(Allocated), "Capacity must fit an allocated callable");
+
+    template<typename Fn>
+    static constexpr bool trivial = storedInline<Fn> && std::is_trivially_copyable_v<Fn> &&
+        std::is_trivially_destructible_v<Fn>;
+
+    template<typename Fn>
+    static Fn& target(void* storage) noexcept;
+
+    template<typename Fn>
+    static R invoke(void* storage, bool owned, Argument<Args>... args);
+
+    template<typename Fn, typename... As>
+    static R invokeTarget(Fn& fn, As&&... args);
+
+    template<typename Fn>
+    static void manage(Operation operation, void* source, void* destination) noexcept;
+
+    void moveFrom(Function& other) noexcept;
+
+    void reset() noexcept;
+
+    alignas(std::max_align_t) mutable std::byte storage[Capacity];
+    Invoker invoker = nullptr;
+    Manager manager = nullptr;
+};
+
+// Callable calling the function `Fn` without storing a pointer to it
+template<auto Fn>
+constexpr auto bind() noexcept
+{
+    return [](auto&&... args) -> decltype(auto) {
+        return std::invoke(Fn, std::forward<decltype(args)>(args)...);
+    };
+}
+
+// Callable calling the member function `Method` of `object` without storing a pointer to it
+template<auto Method, typename Object>
+constexpr auto bind(Object& object) noexcept
+{
+    return [object = std::addressof(object)](auto&&... args) -> decltype(auto) {
+        return std::invoke(Method, object, std::forward<decltype(args)>(args)...);
+    };
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+Function<R(Args...), Capacity>::Function(std::nullptr_t) noexcept
+{
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn>
+    requires(
+        !std::is_same_v<std::remove_cvref_t<Fn>, Function<R(Args...), Capacity>> &&
+        detail::FunctionTarget<std::decay_t<Fn>, R, Args...>)
+Function<R(Args...), Capacity>::Function(Fn&& fn) :
+    Function(std::allocator_arg, allocator_type{}, std::forward<Fn>(fn))
+{
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn>
+    requires(
+        !std::is_same_v<std::remove_cvref_t<Fn>, Function<R(Args...), Capacity>> &&
+        detail::FunctionTarget<std::decay_t<Fn>, R, Args...>)
+Function<R(Args...), Capacity>::Function(
+    std::allocator_arg_t, const allocator_type& allocator, Fn&& fn)
+{
+    using Target = std::decay_t<Fn>;
+
+    // A function is never null, unlike a pointer to it
+    if constexpr (
+        std::is_object_v<std::remove_reference_t<Fn>> && detail::NullableTarget<Target>)
+    {
+        if (fn == nullptr)
+            return;
+    }
+
+    if constexpr (storedInline<Target>)
+        ::new (static_cast<void*>(storage)) Target(std::forward<Fn>(fn));
+    else
+        ::new (static_cast<void*>(storage)) Allocated{
+            allocator_type{allocator}.template new_object<Target>(std::forward<Fn>(fn)),
+            allocator};
+
+    invoker = &invoke<Target>;
+
+    if constexpr (!trivial<Target>)
+        manager = &manage<Target>;
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+Function<R(Args...), Capacity>::Function(Function&& other) noexcept
+{
+    moveFrom(other);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+Function<R(Args...), Capacity>::~Function()
+{
+    reset();
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+auto Function<R(Args...), Capacity>::operator=(Function&& other) noexcept -> Function&
+{
+    if (this == &other)
+        return *this;
+
+    reset();
+    moveFrom(other);
+    return *this;
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+auto Function<R(Args...), Capacity>::operator=(std::nullptr_t) noexcept -> Function&
+{
+    reset();
+    return *this;
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+inline R Function<R(Args...), Capacity>::operator()(Args... args) const
+{
+    if (!invoker)
+        throw std::bad_function_call{};
+
+    return invoker(storage, true, std::forward<Args>(args)...);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+inline R Function<R(Args...), Capacity>::call(Argument<Args>... args) const
+{
+    if (!invoker)
+        throw std::bad_function_call{};
+
+    return invoker(storage, false, std::forward<Argument<Args>>(args)...);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+Function<R(Args...), Capacity>::operator bool() const noexcept
+{
+    return invoker != nullptr;
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+bool Function<R(Args...), Capacity>::operator==(std::nullptr_t) const noexcept
+{
+    return invoker == nullptr;
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn>
+Fn& Function<R(Args...), Capacity>::target(void* storage) noexcept
+{
+    if constexpr (storedInline<Fn>)
+        return *std::launder(static_cast<Fn*>(storage));
+    else
+        return *static_cast<Fn*>(std::launder(static_cast<Allocated*>(storage))->target);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn>
+R Function<R(Args...), Capacity>::invoke(void* storage, bool owned, Argument<Args>... args)
+{
+    auto& fn = target<Fn>(storage);
+
+    // Owned arguments are the parameters of the call operator, so they are not const
+    if (owned)
+        return invokeTarget(fn, std::forward<Args>(const_cast<Args&>(args))...);
+    else if constexpr (std::is_invocable_v<Fn&, Argument<Args>...>)
+        return invokeTarget(fn, std::forward<Argument<Args>>(args)...);
+    else
+        return invokeTarget(fn, static_cast<Args>(std::forward<Argument<Args>>(args))...);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn, typename... As>
+R Function<R(Args...), Capacity>::invokeTarget(Fn& fn, As&&... args)
+{
+    if constexpr (std::is_void_v<R>)
+        std::invoke(fn, std::forward<As>(args)...);
+    else
+        return std::invoke(fn, std::forward<As>(args)...);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+template<typename Fn>
+void Function<R(Args...), Capacity>::manage(
+    Operation operation, void* source, void* destination) noexcept
+{
+    if constexpr (storedInline<Fn>)
+    {
+        auto& fn = target<Fn>(source);
+
+        if (operation == Operation::Move)
+            ::new (destination) Fn(std::move(fn));
+
+        fn.~Fn();
+    }
+    else
+    {
+        auto& allocated = *std::launder(static_cast<Allocated*>(source));
+
+        if (operation == Operation::Move)
+            ::new (destination) Allocated{allocated};
+        else
+            allocated.allocator.delete_object(static_cast<Fn*>(allocated.target));
+    }
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+void Function<R(Args...), Capacity>::moveFrom(Function& other) noexcept
+{
+    if (!other.invoker)
+        return;
+
+    if (other.manager)
+        other.manager(Operation::Move, other.storage, storage);
+    else
+        std::memcpy(storage, other.storage, Capacity);
+
+    invoker = std::exchange(other.invoker, nullptr);
+    manager = std::exchange(other.manager, nullptr);
+}
+
+template<typename R, typename... Args, std::size_t Capacity>
+void Function<R(Args...), Capacity>::reset() noexcept
+{
+    if (manager)
+        manager(Operation::Destroy, storage, nullptr);
+
+    invoker = nullptr;
+    manager = nullptr;
+}
+
+} // namespace signals
+
+#endif
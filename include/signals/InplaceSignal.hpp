@@ -0,0 +1,288 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_INPLACESIGNAL_HPP_
+#define SIGNALS_INPLACESIGNAL_HPP_
+
+#include "Combiner.hpp"
+#include "Connection.hpp"
+#include "IntrusivePtr.hpp"
+#include "Slot.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <span>
+
+namespace signals
+{
+
+// Signal that never allocates, with in-object storage for up to `N` slots
+//
+// Callables must fit into the inline storage of the slot. Connecting to a full signal
+// returns no connection, so that a full signal neither allocates nor throws, while
+// connecting an empty callable returns a connection that is not connected. Slots are constructed on first use and reused once disconnected.
+// The slots live in the signal and are destroyed with it, which disconnects the connections.
+template<
+    typename Signature, std::size_t N,
+    typename Combiner = DefaultCombiner<typename Slot<Signature>::Result>>
+class InplaceSignal : private SlotBase::Owner
+{
+public:
+    InplaceSignal() = default;
+
+    InplaceSignal(const InplaceSignal&) = delete;
+
+    InplaceSignal(InplaceSignal&&) = delete;
+
+    ~InplaceSignal();
+
+    InplaceSignal& operator=(const InplaceSignal&) = delete;
+
+    InplaceSignal& operator=(InplaceSignal&&) = delete;
+
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept;
+
+    void clear();
+
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] auto num_slots() const;
+
+    // Connect unless the signal is full
+    template<typename Fn>
+    std::optional<Connection> connect(Fn&& fn);
+
+    // Emit passing the arguments to the slots by const reference, converted once
+    template<typename... Args>
+    auto operator()(Args&&... args) const;
+
+    // Emit passing the arguments to the combiner as rvalues
+    template<typename... Args>
+    auto emit_moving(Args&&... args) const;
+
+private:
+    class Slot;
+
+    class Emission;
+
+    struct alignas(Slot) Storage
+    {
+        std::byte bytes[sizeof(Slot)];
+    };
+
+    [[nodiscard]] auto activeSlots() const;
+
+    template<typename... Args>
+    auto emit(Args&&... args) const;
+
+    void disconnect(std::span<SlotBase* const> disconnected) override;
+
+    void removeDisconnectedSlots();
+
+    [[nodiscard]] bool emitting() const;
+
+    // Same layout as in `Signal`: active slots are followed by disconnected slots kept for
+    // reuse, and those by the storage not yet used
+    std::array<Storage, N> storage;
+    std::array<IntrusivePtr<Slot>, N> slots;
+    std::size_t size = 0;
+    std::size_t active = 0;
+    std::size_t connected = 0;
+    mutable std::size_t emissions = 0;
+};
+
+// Slot destroyed in place, without a memory resource to allocate from
+template<typename Signature, std::size_t N, typename Combiner>
+class InplaceSignal<Signature, N, Combiner>::Slot final : public signals::Slot<Signature>
+{
+public:
+    using allocator_type = typename signals::Slot<Signature>::allocator_type;
+
+    template<typename Fn>
+    explicit Slot(Fn&& fn) :
+        signals::Slot<Signature>(
+            std::allocator_arg, allocator_type{std::pmr::null_memory_resource()},
+            std::forward<Fn>(fn))
+    {
+    }
+
+private:
+    void destroy() noexcept override
+    {
+        std::destroy_at(this);
+    }
+};
+
+template<typename Signature, std::size_t N, typename Combiner>
+class InplaceSignal<Signature, N, Combiner>::Emission
+{
+public:
+    explicit Emission(std::size_t& emissions) noexcept :
+        emissions(emissions)
+    {
+        ++emissions;
+    }
+
+    Emission(const Emission&) = delete;
+
+    ~Emission()
+    {
+        --emissions;
+    }
+
+    Emission& operator=(const Emission&) = delete;
+
+private:
+    std::size_t& emissions;
+};
+
+template<typename Signature, std::size_t N, typename Combiner>
+InplaceSignal<Signature, N, Combiner>::~InplaceSignal()
+{
+    for (auto& slot : activeSlots())
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    for (auto& slot : slots)
+        if (slot)
+            slot->attach(nullptr, nullptr);
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+constexpr std::size_t InplaceSignal<Signature, N, Combiner>::capacity() noexcept
+{
+    return N;
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+void InplaceSignal<Signature, N, Combiner>::clear()
+{
+    for (auto& slot : activeSlots())
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    // Slots that are still being invoked are reused only after the emission
+    if (!emitting())
+        active = 0;
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+bool InplaceSignal<Signature, N, Combiner>::empty() const
+{
+    return connected == 0;
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+auto InplaceSignal<Signature, N, Combiner>::num_slots() const
+{
+    return static_cast<std::ptrdiff_t>(connected);
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+template<typename Fn>
+std::optional<Connection> InplaceSignal<Signature, N, Combiner>::connect(Fn&& fn)
+{
+    static_assert(
+        Slot::template storedInline<Fn>,
+        "Callable must fit into the inline storage of a slot");
+
+    // Disconnected slots are removed also when there would be no room for a new one
+    if (!emitting() && (active - connected >= connected || active == N))
+        removeDisconnectedSlots();
+
+    if (active == size)
+    {
+        if (size == N)
+            return std::nullopt;
+
+        slots[size] = IntrusivePtr<Slot>{::new (&storage[size]) Slot(std::forward<Fn>(fn))};
+        slots[size++]->attach(&connected, this);
+    }
+    else
+        slots[active]->reconnect(std::forward<Fn>(fn));
+
+    auto& slot = *slots[active++];
+
+    if (slot.connected())
+        ++connected;
+
+    return Connection{slot};
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+auto InplaceSignal<Signature, N, Combiner>::activeSlots() const
+{
+    return std::views::counted(slots.begin(), static_cast<std::ptrdiff_t>(active));
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+void InplaceSignal<Signature, N, Combiner>::disconnect(std::span<SlotBase* const> disconnected)
+{
+    for (auto slot : disconnected)
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    // Slots that are still being invoked are reused only after the emission
+    if (!emitting())
+        removeDisconnectedSlots();
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+void InplaceSignal<Signature, N, Combiner>::removeDisconnectedSlots()
+{
+    auto kept = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < active; ++i)
+        if (slots[i]->connected())
+            std::ranges::swap(slots[kept++], slots[i]);
+
+    active = kept;
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+bool InplaceSignal<Signature, N, Combiner>::emitting() const
+{
+    return emissions != 0;
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+template<typename... Args>
+inline auto InplaceSignal<Signature, N, Combiner>::operator()(Args&&... args) const
+{
+    return Arguments<Signature>::share(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+template<typename... Args>
+inline auto InplaceSignal<Signature, N, Combiner>::emit_moving(Args&&... args) const
+{
+    return Arguments<Signature>::own(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
+}
+
+template<typename Signature, std::size_t N, typename Combiner>
+template<typename... Args>
+inline auto InplaceSignal<Signature, N, Combiner>::emit(Args&&... args) const
+{
+    const auto emission = Emission{emissions};
+    const auto slot = [this](std::size_t i) -> const auto& {
+        return slots[i];
+    };
+
+    return std::invoke(
+        Combiner{},
+        std::views::iota(std::size_t{0}, active) | std::views::transform(slot) |
+            std::views::filter(std::mem_fn(&Slot::enabled)),
+        std::forward<Args>(args)...);
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_INSTRUMENTATION_HPP_
+#define SIGNALS_INSTRUMENTATION_HPP_
+
+#include "ThreadIndex.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace signals
+{
+
+// Instrumentation policy of a signal recording nothing
+//
+// A policy is selected at compile time and compiled out unless `enabled`. An enabled policy
+// is told of each emission with `emitted()`, of each slot skipped as disconnected, blocked
+// or expired with `skipped()`, and of the duration of each slot call with `invoked(latency)`.
+struct NoInstrumentation
+{
+    static constexpr bool enabled = false;
+};
+
+// Instrumentation policy counting the emissions, the invoked and skipped slots, and the
+// latency of the slot calls. Emitting threads count in cache lines of their own, which a
+// snapshot sums up without stopping them.
+class EmissionMetrics
+{
+public:
+    static constexpr bool enabled = true;
+
+    // Bucket i > 0 counts calls that took [2^(i-1), 2^i) nanoseconds, the last bucket also
+    // longer ones, and bucket 0 calls that took less than a nanosecond
+    static constexpr std::size_t latencyBuckets = 32;
+
+    struct Snapshot
+    {
+        std::uint64_t emissions = 0;
+        std::uint64_t invocations = 0;
+        std::uint64_t skipped = 0;
+        std::array<std::uint64_t, latencyBuckets> latency = {};
+
+        // Share of the slots reached while emitting that were skipped
+        [[nodiscard]] double deadSlotRatio() const noexcept;
+    };
+
+    EmissionMetrics() = default;
+
+    EmissionMetrics(const EmissionMetrics&) = delete;
+
+    EmissionMetrics(EmissionMetrics&&) = delete;
+
+    ~EmissionMetrics();
+
+    EmissionMetrics& operator=(const EmissionMetrics&) = delete;
+
+    EmissionMetrics& operator=(EmissionMetrics&&) = delete;
+
+    // Include the metrics in the snapshots of MetricsRegistry under the name while they exist
+    void publish(std::string name);
+
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+    void emitted() noexcept;
+
+    void skipped() noexcept;
+
+    void invoked(std::chrono::nanoseconds latency) noexcept;
+
+private:
+    static constexpr std::size_t shards = 8;
+
+    struct alignas(detail::cacheLineSize) Counters
+    {
+        std::atomic<std::uint64_t> emissions = 0;
+        std::atomic<std::uint64_t> invocations = 0;
+        std::atomic<std::uint64_t> skipped = 0;
+        std::array<std::atomic<std::uint64_t>, latencyBuckets> latency = {};
+    };
+
+    [[nodiscard]] Counters& local() noexcept;
+
+    std::array<Counters, shards> counters = {};
+    bool published = false;
+};
+
+// Registry of the published emission metrics
+class MetricsRegistry
+{
+public:
+    using Entry = std::pair<std::string, EmissionMetrics::Snapshot>;
+
+    MetricsRegistry() = delete;
+
+    // Snapshots of the published metrics ordered by name
+    [[nodiscard]] static std::vector<Entry> snapshot();
+
+private:
+    friend class EmissionMetrics;
+
+    static void add(std::string name, const EmissionMetrics& metrics);
+
+    static void remove(const EmissionMetrics& metrics);
+};
+
+namespace detail
+{
+
+// Timer of a slot call, telling the instrumentation of its duration once it has returned.
+// The instrumentation is looked up only then, as the call can destroy the signal with it.
+template<typename Instrumentation>
+class SlotTimer
+{
+public:
+    explicit SlotTimer(Instrumentation* const& metrics) noexcept :
+        metrics(metrics),
+        start(std::chrono::steady_clock::now())
+    {
+    }
+
+    SlotTimer(const SlotTimer&) = delete;
+
+    ~SlotTimer()
+    {
+        if (metrics)
+            metrics->invoked(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start));
+    }
+
+    SlotTimer& operator=(const SlotTimer&) = delete;
+
+private:
+    Instrumentation* const& metrics;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace detail
+
+inline void EmissionMetrics::emitted() noexcept
+{
+    local().emissions.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void EmissionMetrics::skipped() noexcept
+{
+    local().skipped.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void EmissionMetrics::invoked(std::chrono::nanoseconds latency) noexcept
+{
+    const auto bucket = std::min<std::size_t>(
+        std::bit_width(static_cast<std::uint64_t>(latency.count())), latencyBuckets - 1);
+    auto& counters = local();
+
+    counters.invocations.fetch_add(1, std::memory_order_relaxed);
+    counters.latency[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline auto EmissionMetrics::local() noexcept -> Counters&
+{
+    return counters[detail::threadIndex() % shards];
+}
+
+} // namespace signals
+
+#endif
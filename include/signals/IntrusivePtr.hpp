@@ -0,0 +1,136 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_INTRUSIVEPTR_HPP_
+#define SIGNALS_INTRUSIVEPTR_HPP_
+
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+// Smart pointer to an object that keeps its own reference count
+// by providing `retain()` and `release()` member functions
+template<typename T>
+class IntrusivePtr
+{
+public:
+    IntrusivePtr() noexcept = default;
+
+    explicit IntrusivePtr(T* pointer) noexcept;
+
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusivePtr(const IntrusivePtr<U>& other) noexcept;
+
+    IntrusivePtr(const IntrusivePtr& other) noexcept;
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept;
+
+    ~IntrusivePtr();
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) noexcept;
+
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept;
+
+    [[nodiscard]] T* get() const noexcept;
+
+    T& operator*() const noexcept;
+
+    T* operator->() const noexcept;
+
+    explicit operator bool() const noexcept;
+
+    void reset() noexcept;
+
+private:
+    T* pointer = nullptr;
+};
+
+template<typename T>
+IntrusivePtr<T>::IntrusivePtr(T* pointer) noexcept :
+    pointer(pointer)
+{
+    if (pointer)
+        pointer->retain();
+}
+
+template<typename T>
+template<typename U>
+    requires std::is_convertible_v<U*, T*>
+IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr<U>& other) noexcept :
+    IntrusivePtr(other.get())
+{
+}
+
+template<typename T>
+IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr& other) noexcept :
+    IntrusivePtr(other.pointer)
+{
+}
+
+template<typename T>
+IntrusivePtr<T>::IntrusivePtr(IntrusivePtr&& other) noexcept :
+    pointer(std::exchange(other.pointer, nullptr))
+{
+}
+
+template<typename T>
+IntrusivePtr<T>::~IntrusivePtr()
+{
+    reset();
+}
+
+template<typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(const IntrusivePtr& other) noexcept
+{
+    auto copy = other;
+    std::swap(pointer, copy.pointer);
+    return *this;
+}
+
+template<typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(IntrusivePtr&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    reset();
+    pointer = std::exchange(other.pointer, nullptr);
+    return *this;
+}
+
+template<typename T>
+T* IntrusivePtr<T>::get() const noexcept
+{
+    return pointer;
+}
+
+template<typename T>
+T& IntrusivePtr<T>::operator*() const noexcept
+{
+    return *pointer;
+}
+
+template<typename T>
+T* IntrusivePtr<T>::operator->() const noexcept
+{
+    return pointer;
+}
+
+template<typename T>
+IntrusivePtr<T>::operator bool() const noexcept
+{
+    return pointer != nullptr;
+}
+
+template<typename T>
+void IntrusivePtr<T>::reset() noexcept
+{
+    if (auto p = std::exchange(pointer, nullptr); p)
+        p->release();
+}
+
+} // namespace signals
+
+#endif
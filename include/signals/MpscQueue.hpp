@@ -0,0 +1,123 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_MPSCQUEUE_HPP_
+#define SIGNALS_MPSCQUEUE_HPP_
+
+#include "RingBuffer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+namespace signals
+{
+
+// Lock-free multiple producer, single consumer queue
+//
+// Any thread may push, but only one thread at a time may pop. A value pushed
+// by a producer that has not finished pushing may not be seen by the consumer yet.
+// The nodes of popped values are kept for reuse, up to `Spares` of them, so pushing
+// allocates only when there is no spare node, such as when more values are queued at once
+// than before.
+template<typename T, std::size_t Spares = 64>
+class MpscQueue
+{
+public:
+    MpscQueue();
+
+    MpscQueue(const MpscQueue&) = delete;
+
+    MpscQueue(MpscQueue&&) = delete;
+
+    ~MpscQueue();
+
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    void push(T value);
+
+    std::optional<T> pop();
+
+private:
+    struct Node
+    {
+        std::atomic<Node*> next = nullptr;
+        std::optional<T> value;
+    };
+
+    void recycle(Node* node) noexcept;
+
+    // Producers push to the head, the consumer pops from the tail,
+    // which is a node whose value has already been popped
+    std::atomic<Node*> head;
+    Node* tail;
+    RingBuffer<Node*, Spares> spares;
+};
+
+template<typename T, std::size_t Spares>
+MpscQueue<T, Spares>::MpscQueue() :
+    head(new Node),
+    tail(head.load())
+{
+}
+
+template<typename T, std::size_t Spares>
+MpscQueue<T, Spares>::~MpscQueue()
+{
+    while (pop())
+        ;
+
+    delete tail;
+
+    while (const auto node = spares.tryPop())
+        delete *node;
+}
+
+template<typename T, std::size_t Spares>
+void MpscQueue<T, Spares>::push(T value)
+{
+    auto spare = spares.tryPop();
+    auto node = spare ? *spare : new Node;
+
+    try
+    {
+        node->value.emplace(std::move(value));
+    }
+    catch (...)
+    {
+        recycle(node);
+        throw;
+    }
+
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    const auto previous = head.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+template<typename T, std::size_t Spares>
+std::optional<T> MpscQueue<T, Spares>::pop()
+{
+    const auto next = tail->next.load(std::memory_order_acquire);
+
+    if (!next)
+        return std::nullopt;
+
+    auto value = std::move(next->value);
+    next->value.reset();
+    recycle(tail);
+    tail = next;
+    return value;
+}
+
+template<typename T, std::size_t Spares>
+void MpscQueue<T, Spares>::recycle(Node* node) noexcept
+{
+    // No producer refers to a node once the consumer has moved past it
+    if (!spares.tryEmplace(node))
+        delete node;
+}
+
+} // namespace signals
+
+#endif
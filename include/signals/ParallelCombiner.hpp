@@ -0,0 +1,198 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_PARALLELCOMBINER_HPP_
+#define SIGNALS_PARALLELCOMBINER_HPP_
+
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <vector>
+
+namespace signals
+{
+
+struct SharedThreadPool
+{
+    ThreadPool& operator()() const
+    {
+        return ThreadPool::shared();
+    }
+};
+
+namespace detail
+{
+
+template<typename Slots>
+auto collectSlots(Slots& slots)
+{
+    auto collected = std::vector<decltype(std::addressof(*std::ranges::begin(slots)))>{};
+
+    for (auto& slot : slots)
+        collected.push_back(std::addressof(slot));
+
+    return collected;
+}
+
+// Storage of values written concurrently at their own indices. Unlike std::vector<bool>,
+// it never packs several values into one word.
+template<typename R>
+auto unpackedArray(std::size_t size)
+{
+    return std::make_unique<R[]>(size);
+}
+
+// Several chunks per thread let the idle workers balance uneven slots by stealing
+inline std::size_t chunkCount(const ThreadPool& pool, std::size_t size)
+{
+    return std::min(size, 4 * (pool.size() + 1));
+}
+
+// Call `fn(chunk, first, last)` for the chunks of `[0, size)` on the pool and this thread
+//
+// The calling thread runs pending tasks of the pool before waiting, so a fan out from within
+// a task of the same pool cannot run out of workers. The first exception thrown by `fn`
+// is rethrown once every chunk has finished.
+template<typename Fn>
+void parallelFor(ThreadPool& pool, std::size_t chunks, std::size_t size, const Fn& fn)
+{
+    if (chunks == 0)
+        return;
+
+    auto mutex = std::mutex{};
+    auto finished = std::condition_variable{};
+    auto remaining = chunks;
+    auto error = std::exception_ptr{};
+
+    const auto run = [&](std::size_t chunk) {
+        try
+        {
+            std::invoke(fn, chunk, size * chunk / chunks, size * (chunk + 1) / chunks);
+        }
+        catch (...)
+        {
+            const auto lock = std::scoped_lock{mutex};
+
+            if (!error)
+                error = std::current_exception();
+        }
+
+        // Notifying while holding the lock keeps the waiting thread from returning
+        // and destroying the state before the notification has been sent
+        const auto lock = std::scoped_lock{mutex};
+
+        if (--remaining == 0)
+            finished.notify_one();
+    };
+
+    for (auto chunk = std::size_t{1}; chunk < chunks; ++chunk)
+        pool.post([&run, chunk] { run(chunk); });
+
+    run(0);
+
+    while (pool.tryRun())
+        ;
+
+    auto lock = std::unique_lock{mutex};
+    finished.wait(lock, [&remaining] { return remaining == 0; });
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace detail
+
+// Combiner calling the slots concurrently on a work-stealing pool
+//
+// Returns the results of the slots in the order the slots were connected. The slots must be
+// safe to call concurrently and must not connect or disconnect slots of a Signal while it is
+// being emitted, ConcurrentSignal allows that.
+template<typename R, typename Pool = SharedThreadPool>
+struct ParallelCombiner
+{
+    template<typename Slots, typename... Args>
+    std::vector<R> operator()(Slots slots, Args&&... args) const
+    {
+        const auto collected = detail::collectSlots(slots);
+        auto& pool = Pool{}();
+        auto results = detail::unpackedArray<R>(collected.size());
+
+        detail::parallelFor(
+            pool, detail::chunkCount(pool, collected.size()), collected.size(),
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; ++i)
+                    results[i] = std::invoke(**collected[i], args...);
+            });
+
+        return std::vector<R>(
+            std::make_move_iterator(results.get()),
+            std::make_move_iterator(results.get() + collected.size()));
+    }
+};
+
+template<typename Pool>
+struct ParallelCombiner<void, Pool>
+{
+    template<typename Slots, typename... Args>
+    void operator()(Slots slots, Args&&... args) const
+    {
+        const auto collected = detail::collectSlots(slots);
+        auto& pool = Pool{}();
+
+        detail::parallelFor(
+            pool, detail::chunkCount(pool, collected.size()), collected.size(),
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; ++i)
+                    std::invoke(**collected[i], args...);
+            });
+    }
+};
+
+// Combiner calling the slots concurrently and reducing their results with `Reduce`
+//
+// Each chunk of slots reduces its results into a partial result of its own and the partial
+// results are reduced in order once all the chunks have finished, so `Reduce` must be
+// associative but need not be commutative nor thread-safe. Returns `R{}` without slots.
+template<typename R, typename Reduce = std::plus<R>, typename Pool = SharedThreadPool>
+struct ParallelReduceCombiner
+{
+    template<typename Slots, typename... Args>
+    R operator()(Slots slots, Args&&... args) const
+    {
+        const auto collected = detail::collectSlots(slots);
+        auto& pool = Pool{}();
+        const auto chunks = detail::chunkCount(pool, collected.size());
+        auto partials = detail::unpackedArray<R>(chunks);
+
+        detail::parallelFor(
+            pool, chunks, collected.size(),
+            [&](std::size_t chunk, std::size_t first, std::size_t last) {
+                auto partial = std::invoke(**collected[first], args...);
+
+                for (auto i = first + 1; i < last; ++i)
+                    partial = std::invoke(
+                        Reduce{}, std::move(partial), std::invoke(**collected[i], args...));
+
+                partials[chunk] = std::move(partial);
+            });
+
+        if (chunks == 0)
+            return R{};
+
+        auto r = std::move(partials[0]);
+
+        for (auto chunk = std::size_t{1}; chunk < chunks; ++chunk)
+            r = std::invoke(Reduce{}, std::move(r), std::move(partials[chunk]));
+
+        return r;
+    }
+};
+
+} // namespace signals
+
+#endif
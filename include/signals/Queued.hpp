@@ -0,0 +1,104 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_QUEUED_HPP_
+#define SIGNALS_QUEUED_HPP_
+
+#include "EventLoop.hpp"
+#include "Executor.hpp"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace signals
+{
+
+// Slot posting every call to an executor instead of calling the target directly
+//
+// The arguments are copied into the posted task once and moved into the target when the
+// task is run. Tasks still pending when the slot is destroyed, for example disconnected
+// from a Signal, do not call the target anymore. ConcurrentSignal keeps a disconnected
+// slot until no emission uses it, so it cancels the pending tasks when the slot is
+// disconnected instead. A task that has already started calling the target finishes the
+// call. The executor must outlive the slot.
+template<typename Fn>
+class Queued
+{
+public:
+    Queued(Executor& executor, Fn fn);
+
+    template<typename... Args>
+    void operator()(Args&&... args) const;
+
+    // Stop calling the target from the tasks that are still pending, or posted later
+    void cancel() const noexcept;
+
+private:
+    struct Target
+    {
+        explicit Target(Fn fn);
+
+        Fn fn;
+        std::atomic<bool> cancelled = false;
+    };
+
+    Executor* executor;
+    std::shared_ptr<Target> target;
+};
+
+// Connect with `signal.connect(queued(executor, fn))` to call `fn` on the executor
+template<typename Fn>
+auto queued(Executor& executor, Fn&& fn)
+{
+    return Queued<std::decay_t<Fn>>{executor, std::forward<Fn>(fn)};
+}
+
+// Connect with `signal.connect(queued("loop", fn))` to call `fn` on the named event loop
+template<typename Fn>
+auto queued(std::string_view loop, Fn&& fn)
+{
+    const auto eventLoop = EventLoop::find(loop);
+
+    if (!eventLoop)
+        throw std::invalid_argument{"No event loop named " + std::string{loop}};
+
+    return queued(*eventLoop, std::forward<Fn>(fn));
+}
+
+template<typename Fn>
+Queued<Fn>::Queued(Executor& executor, Fn fn) :
+    executor(&executor),
+    target(std::make_shared<Target>(std::move(fn)))
+{
+}
+
+template<typename Fn>
+template<typename... Args>
+void Queued<Fn>::operator()(Args&&... args) const
+{
+    using Arguments = std::tuple<std::decay_t<Args>...>;
+
+    executor->post([target = std::weak_ptr{target},
+                    arguments = Arguments{std::forward<Args>(args)...}]() mutable {
+        if (const auto t = target.lock(); t && !t->cancelled.load(std::memory_order_acquire))
+            std::apply(t->fn, std::move(arguments));
+    });
+}
+
+template<typename Fn>
+void Queued<Fn>::cancel() const noexcept
+{
+    target->cancelled.store(true, std::memory_order_release);
+}
+
+template<typename Fn>
+Queued<Fn>::Target::Target(Fn fn) :
+    fn(std::move(fn))
+{
+}
+
+} // namespace signals
+
+#endif
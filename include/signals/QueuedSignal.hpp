@@ -0,0 +1,213 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_QUEUEDSIGNAL_HPP_
+#define SIGNALS_QUEUEDSIGNAL_HPP_
+
+#include "RingBuffer.hpp"
+#include "Signal.hpp"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace signals
+{
+
+// What emitting does when the buffer of a QueuedSignal is full
+enum class Backpressure
+{
+    DropOldest, // Drop the oldest queued event to make room
+    DropNewest, // Drop the emitted event
+    Block,      // Wait for the consumer to make room
+    Spin        // Busy-wait for the consumer to make room
+};
+
+template<
+    typename Signature, std::size_t Capacity, Backpressure Policy = Backpressure::Block,
+    typename Combiner = DefaultCombiner<void>>
+class QueuedSignal;
+
+// Signal emitted on any thread and delivered on the consumer thread
+//
+// Emitting only queues the event into a ring buffer of `Capacity` events, constructed there
+// without allocating. The consumer thread drains the buffer, calling the slots in batches.
+// Slots are connected, disconnected and called on the consumer thread only. With the
+// default combiner, slots taking a batch of events get a drained batch in one call.
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+class QueuedSignal<void(Args...), Capacity, Policy, Combiner>
+{
+public:
+    using Signal = signals::Signal<void(Args...), Combiner>;
+
+    using Event = typename Signal::Event;
+
+    QueuedSignal();
+
+    QueuedSignal(const QueuedSignal&) = delete;
+
+    QueuedSignal(QueuedSignal&&) = delete;
+
+    ~QueuedSignal() = default;
+
+    QueuedSignal& operator=(const QueuedSignal&) = delete;
+
+    QueuedSignal& operator=(QueuedSignal&&) = delete;
+
+    void clear();
+
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] auto num_slots() const;
+
+    template<typename Fn>
+    auto connect(Fn&& fn);
+
+    // Queue the event from any thread. Returns false if the event was dropped.
+    template<typename... As>
+    bool operator()(As&&... args) const;
+
+    // Call the slots with at most `Capacity` queued events on the consumer thread and return
+    // their number. Returns even when producers keep up with the slots.
+    std::size_t drain();
+
+    // Number of events dropped because the buffer was full
+    [[nodiscard]] std::size_t dropped() const noexcept;
+
+private:
+    template<typename... As>
+    bool push(As&&... args) const;
+
+    void deliver();
+
+    mutable RingBuffer<Event, Capacity> events;
+    mutable std::atomic<std::size_t> drops = 0;
+    std::atomic<std::size_t> drains = 0;
+    std::vector<Event> batch;
+    Signal signal;
+};
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+QueuedSignal<void(Args...), Capacity, Policy, Combiner>::QueuedSignal()
+{
+    batch.reserve(Capacity);
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+void QueuedSignal<void(Args...), Capacity, Policy, Combiner>::clear()
+{
+    signal.clear();
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+bool QueuedSignal<void(Args...), Capacity, Policy, Combiner>::empty() const
+{
+    return signal.empty();
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+auto QueuedSignal<void(Args...), Capacity, Policy, Combiner>::num_slots() const
+{
+    return signal.num_slots();
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+template<typename Fn>
+auto QueuedSignal<void(Args...), Capacity, Policy, Combiner>::connect(Fn&& fn)
+{
+    return signal.connect(std::forward<Fn>(fn));
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+template<typename... As>
+bool QueuedSignal<void(Args...), Capacity, Policy, Combiner>::operator()(As&&... args) const
+{
+    // An event that may throw while constructed is constructed before claiming a cell
+    if constexpr (std::is_nothrow_constructible_v<Event, As&&...>)
+        return push(std::forward<As>(args)...);
+    else
+        return push(Event(std::forward<As>(args)...));
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+template<typename... As>
+bool QueuedSignal<void(Args...), Capacity, Policy, Combiner>::push(As&&... args) const
+{
+    // The arguments are moved from only by the push that succeeds
+    for (;;)
+    {
+        [[maybe_unused]] const auto seen = Policy == Backpressure::Block
+            ? drains.load(std::memory_order_acquire)
+            : std::size_t{0};
+
+        if (events.tryEmplace(std::forward<As>(args)...))
+            return true;
+
+        if constexpr (Policy == Backpressure::DropNewest)
+        {
+            drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else if constexpr (Policy == Backpressure::DropOldest)
+        {
+            if (events.tryPop())
+                drops.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if constexpr (Policy == Backpressure::Block)
+            drains.wait(seen, std::memory_order_acquire);
+    }
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+std::size_t QueuedSignal<void(Args...), Capacity, Policy, Combiner>::drain()
+{
+    batch.clear();
+
+    while (batch.size() < Capacity)
+    {
+        auto event = events.tryPop();
+
+        if (!event)
+            break;
+
+        batch.push_back(std::move(*event));
+    }
+
+    if (batch.empty())
+        return 0;
+
+    if constexpr (Policy == Backpressure::Block)
+    {
+        drains.fetch_add(1, std::memory_order_release);
+        drains.notify_all();
+    }
+
+    deliver();
+    return batch.size();
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+std::size_t QueuedSignal<void(Args...), Capacity, Policy, Combiner>::dropped() const noexcept
+{
+    return drops.load(std::memory_order_relaxed);
+}
+
+template<typename... Args, std::size_t Capacity, Backpressure Policy, typename Combiner>
+void QueuedSignal<void(Args...), Capacity, Policy, Combiner>::deliver()
+{
+    // Other combiners are called once per event, as batches bypass the combiner
+    if constexpr (std::is_same_v<Combiner, DefaultCombiner<void>>)
+        signal.emit_batch(batch);
+    else if constexpr (sizeof...(Args) == 1)
+        for (const auto& event : batch)
+            std::invoke(signal, event);
+    else
+        for (const auto& event : batch)
+            std::apply(signal, event);
+}
+
+} // namespace signals
+
+#endif
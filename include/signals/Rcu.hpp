@@ -0,0 +1,184 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_RCU_HPP_
+#define SIGNALS_RCU_HPP_
+
+#include "ThreadIndex.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace signals
+{
+
+// Read-copy-update cell with epoch based reclamation
+//
+// Readers never block: they enter the current epoch, read the published value and leave.
+// Writers publish a new value and retire the old one, which is destroyed only once every
+// reader that could still see it has left. Writers are not synchronized with each other,
+// callers must serialize calls to `current()` and `update()`.
+//
+// Readers are counted in `Shards` cache lines picked by the reading thread, so that readers
+// on different threads do not contend on the same counter. Writers check all of them.
+template<typename T, std::size_t Shards = 1>
+class Rcu
+{
+public:
+    Rcu();
+
+    explicit Rcu(std::unique_ptr<const T> value);
+
+    Rcu(const Rcu&) = delete;
+
+    Rcu(Rcu&&) = delete;
+
+    ~Rcu();
+
+    Rcu& operator=(const Rcu&) = delete;
+
+    Rcu& operator=(Rcu&&) = delete;
+
+    template<typename Fn>
+    auto read(Fn&& fn) const;
+
+    [[nodiscard]] const T& current() const;
+
+    void update(std::unique_ptr<const T> value);
+
+private:
+    using Epoch = std::size_t;
+
+    struct alignas(detail::cacheLineSize) Readers
+    {
+        std::array<std::atomic<std::size_t>, 2> epochs = {};
+    };
+
+    struct Retired
+    {
+        std::unique_ptr<const T> value;
+        Epoch epoch;
+    };
+
+    class Reader;
+
+    void reclaim();
+
+    [[nodiscard]] bool hasReaders(Epoch epoch) const;
+
+    std::atomic<const T*> value;
+    std::atomic<Epoch> epoch = 0;
+    mutable std::array<Readers, Shards> readers = {};
+    std::vector<Retired> retired;
+};
+
+template<typename T, std::size_t Shards>
+class Rcu<T, Shards>::Reader
+{
+public:
+    explicit Reader(const Rcu& rcu) noexcept;
+
+    Reader(const Reader&) = delete;
+
+    ~Reader();
+
+    Reader& operator=(const Reader&) = delete;
+
+private:
+    std::atomic<std::size_t>* readers;
+};
+
+template<typename T, std::size_t Shards>
+Rcu<T, Shards>::Reader::Reader(const Rcu& rcu) noexcept
+{
+    auto& shard = rcu.readers[Shards == 1 ? 0 : detail::threadIndex() % Shards];
+
+    // A reader that registers to an epoch that has already ended must retry,
+    // otherwise the writer could not tell when it is safe to reclaim
+    for (;;)
+    {
+        const auto epoch = rcu.epoch.load();
+        readers = &shard.epochs[epoch % 2];
+        readers->fetch_add(1);
+
+        if (rcu.epoch.load() == epoch)
+            break;
+
+        readers->fetch_sub(1);
+    }
+}
+
+template<typename T, std::size_t Shards>
+Rcu<T, Shards>::Reader::~Reader()
+{
+    readers->fetch_sub(1);
+}
+
+template<typename T, std::size_t Shards>
+Rcu<T, Shards>::Rcu() :
+    Rcu(std::make_unique<const T>())
+{
+}
+
+template<typename T, std::size_t Shards>
+Rcu<T, Shards>::Rcu(std::unique_ptr<const T> value) :
+    value(value.release())
+{
+}
+
+template<typename T, std::size_t Shards>
+Rcu<T, Shards>::~Rcu()
+{
+    delete value.load();
+}
+
+template<typename T, std::size_t Shards>
+template<typename Fn>
+inline auto Rcu<T, Shards>::read(Fn&& fn) const
+{
+    const auto reader = Reader{*this};
+    return std::invoke(std::forward<Fn>(fn), *value.load());
+}
+
+template<typename T, std::size_t Shards>
+const T& Rcu<T, Shards>::current() const
+{
+    return *value.load();
+}
+
+template<typename T, std::size_t Shards>
+void Rcu<T, Shards>::update(std::unique_ptr<const T> value)
+{
+    auto old = std::unique_ptr<const T>{this->value.exchange(value.release())};
+    retired.push_back({std::move(old), epoch.load()});
+    reclaim();
+}
+
+template<typename T, std::size_t Shards>
+void Rcu<T, Shards>::reclaim()
+{
+    // The epoch can be advanced once the readers of the previous epoch have left.
+    // Readers of the current epoch may still see values retired during the epoch,
+    // so a value is safe to reclaim only after two epochs have passed.
+    for (auto i = 0; i < 2 && !hasReaders(epoch.load() + 1); ++i)
+        epoch.fetch_add(1);
+
+    std::erase_if(retired, [epoch = epoch.load()](const auto& r) {
+        return r.epoch + 2 <= epoch;
+    });
+}
+
+template<typename T, std::size_t Shards>
+bool Rcu<T, Shards>::hasReaders(Epoch epoch) const
+{
+    return std::ranges::any_of(readers, [epoch](const Readers& shard) {
+        return shard.epochs[epoch % 2].load() != 0;
+    });
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,149 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_RESULTS_HPP_
+#define SIGNALS_RESULTS_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+// Input range of the results of the slots
+//
+// A slot is invoked only when its result is dereferenced, and only once: the result is
+// cached in the iterator until it is incremented. Algorithms that stop early, such as
+// `std::ranges::find_if`, invoke only the slots they need. The arguments are referred to,
+// so the range must not outlive them.
+template<std::ranges::input_range Slots, typename... Args>
+class Results : public std::ranges::view_interface<Results<Slots, Args...>>
+{
+public:
+    using Result = std::remove_cvref_t<decltype(std::invoke(
+        *std::declval<std::ranges::range_reference_t<Slots>>(), std::declval<Args&>()...))>;
+
+    class Iterator;
+
+    Results() = default;
+
+    explicit Results(Slots slots, Args&... args);
+
+    Iterator begin();
+
+    auto end();
+
+private:
+    Slots slots;
+    std::tuple<Args*...> args;
+};
+
+template<std::ranges::input_range Slots, typename... Args>
+class Results<Slots, Args...>::Iterator
+{
+public:
+    using iterator_concept = std::input_iterator_tag;
+
+    using value_type = Result;
+
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    Iterator(const Results& results, std::ranges::iterator_t<Slots> slot);
+
+    Result& operator*() const;
+
+    Iterator& operator++();
+
+    void operator++(int);
+
+    bool operator==(const std::ranges::sentinel_t<Slots>& end) const;
+
+private:
+    const Results* results = nullptr;
+    std::ranges::iterator_t<Slots> slot;
+    mutable std::optional<Result> result;
+};
+
+// Combiner passing the lazy range of the results of the slots to `Fn{}`
+template<typename Fn>
+struct LazyCombiner
+{
+    template<typename Slots, typename... Args>
+    decltype(auto) operator()(Slots slots, Args&&... args) const
+    {
+        using Range = Results<Slots, std::remove_reference_t<Args>...>;
+        return std::invoke(Fn{}, Range{std::move(slots), args...});
+    }
+};
+
+template<std::ranges::input_range Slots, typename... Args>
+Results<Slots, Args...>::Results(Slots slots, Args&... args) :
+    slots(std::move(slots)),
+    args(std::addressof(args)...)
+{
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+auto Results<Slots, Args...>::begin() -> Iterator
+{
+    return Iterator{*this, std::ranges::begin(slots)};
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+auto Results<Slots, Args...>::end()
+{
+    return std::ranges::end(slots);
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+Results<Slots, Args...>::Iterator::Iterator(
+    const Results& results, std::ranges::iterator_t<Slots> slot) :
+    results(&results),
+    slot(std::move(slot))
+{
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+auto Results<Slots, Args...>::Iterator::operator*() const -> Result&
+{
+    if (!result)
+        result.emplace(std::apply(
+            [this](Args*... args) -> decltype(auto) {
+                return std::invoke(**slot, *args...);
+            },
+            results->args));
+
+    return *result;
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+auto Results<Slots, Args...>::Iterator::operator++() -> Iterator&
+{
+    ++slot;
+    result.reset();
+    return *this;
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+void Results<Slots, Args...>::Iterator::operator++(int)
+{
+    ++*this;
+}
+
+template<std::ranges::input_range Slots, typename... Args>
+bool Results<Slots, Args...>::Iterator::operator==(
+    const std::ranges::sentinel_t<Slots>& end) const
+{
+    return slot == end;
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,147 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_RINGBUFFER_HPP_
+#define SIGNALS_RINGBUFFER_HPP_
+
+#include "ThreadIndex.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace signals
+{
+
+// Bounded lock-free queue of values stored in place, for any number of producers and
+// consumers
+//
+// Each cell has a sequence number telling whether it is free for the push or full for the
+// pop of the current lap, so pushing and popping claim a cell with a single compare and swap
+// and never allocate. A value is constructed in its cell only once the cell is claimed.
+template<typename T, std::size_t Capacity>
+class RingBuffer
+{
+public:
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    static_assert(
+        std::is_nothrow_move_constructible_v<T>, "Values must be moved without throwing");
+
+    RingBuffer() noexcept;
+
+    RingBuffer(const RingBuffer&) = delete;
+
+    RingBuffer(RingBuffer&&) = delete;
+
+    ~RingBuffer();
+
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    RingBuffer& operator=(RingBuffer&&) = delete;
+
+    // Construct a value from the arguments, or return false if the buffer is full
+    template<typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    // Pop the oldest value, if any
+    std::optional<T> tryPop();
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    [[nodiscard]] static T& value(Cell& cell) noexcept;
+
+    alignas(detail::cacheLineSize) std::atomic<std::size_t> head = 0;
+    alignas(detail::cacheLineSize) std::atomic<std::size_t> tail = 0;
+    alignas(detail::cacheLineSize) std::array<Cell, Capacity> cells;
+};
+
+template<typename T, std::size_t Capacity>
+RingBuffer<T, Capacity>::RingBuffer() noexcept
+{
+    for (auto i = std::size_t{0}; i < Capacity; ++i)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename T, std::size_t Capacity>
+RingBuffer<T, Capacity>::~RingBuffer()
+{
+    while (tryPop())
+        ;
+}
+
+template<typename T, std::size_t Capacity>
+template<typename... Args>
+bool RingBuffer<T, Capacity>::tryEmplace(Args&&... args)
+{
+    static_assert(
+        std::is_nothrow_constructible_v<T, Args&&...>,
+        "Values must be constructed without throwing once the cell is claimed");
+
+    auto position = head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        auto& cell = cells[position % Capacity];
+        const auto lap = static_cast<std::intptr_t>(
+            cell.sequence.load(std::memory_order_acquire) - position);
+
+        if (lap < 0)
+            return false;
+
+        if (lap > 0)
+            position = head.load(std::memory_order_relaxed);
+        else if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            ::new (static_cast<void*>(cell.storage)) T(std::forward<Args>(args)...);
+            cell.sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+template<typename T, std::size_t Capacity>
+std::optional<T> RingBuffer<T, Capacity>::tryPop()
+{
+    auto position = tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        auto& cell = cells[position % Capacity];
+        const auto lap = static_cast<std::intptr_t>(
+            cell.sequence.load(std::memory_order_acquire) - (position + 1));
+
+        if (lap < 0)
+            return std::nullopt;
+
+        if (lap > 0)
+            position = tail.load(std::memory_order_relaxed);
+        else if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            auto popped = std::optional<T>{std::move(value(cell))};
+            std::destroy_at(&value(cell));
+            cell.sequence.store(position + Capacity, std::memory_order_release);
+            return popped;
+        }
+    }
+}
+
+template<typename T, std::size_t Capacity>
+T& RingBuffer<T, Capacity>::value(Cell& cell) noexcept
+{
+    return *std::launder(reinterpret_cast<T*>(cell.storage));
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_SHAREDCONNECTIONBLOCK_HPP_
+#define SIGNALS_SHAREDCONNECTIONBLOCK_HPP_
+
+#include "Connection.hpp"
+
+namespace signals
+{
+
+// Blocks the slot of a connection for as long as it is blocking. The slot is blocked while
+// any block of it is blocking, and a copy of a blocking block blocks too.
+class SharedConnectionBlock
+{
+public:
+    SharedConnectionBlock() = default;
+
+    explicit SharedConnectionBlock(const Connection& connection, bool blocking = true);
+
+    SharedConnectionBlock(const SharedConnectionBlock& other);
+
+    SharedConnectionBlock(SharedConnectionBlock&& other) noexcept;
+
+    ~SharedConnectionBlock();
+
+    SharedConnectionBlock& operator=(const SharedConnectionBlock& other);
+
+    SharedConnectionBlock& operator=(SharedConnectionBlock&& other) noexcept;
+
+    void block();
+
+    void unblock();
+
+    [[nodiscard]] bool blocking() const noexcept;
+
+    [[nodiscard]] Connection connection() const;
+
+private:
+    Connection blocked;
+    bool isBlocking = false;
+};
+
+} // namespace signals
+
+#endif
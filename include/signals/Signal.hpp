@@ -5,31 +5,61 @@
 
 #include "Combiner.hpp"
 #include "Connection.hpp"
+#include "Executor.hpp"
+#include "Instrumentation.hpp"
+#include "IntrusivePtr.hpp"
 #include "Slot.hpp"
+#include "Tracked.hpp"
 #include <algorithm>
+#include <coroutine>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace signals
 {
 
+// Slots are invoked in the order of their groups, and in connection order within a group.
+// The order is kept when connecting, so that an emission is a linear scan of the slots.
+//
+// Emissions are recorded by the `Instrumentation` policy, such as EmissionMetrics. The
+// default policy records nothing and adds neither size nor work to the signal.
 template<
-    typename Signature, typename Combiner = DefaultCombiner<typename Slot<Signature>::Result>>
-class Signal
+    typename Signature,
+    typename Combiner = DefaultCombiner<typename Slot<Signature>::Result>,
+    typename Instrumentation = NoInstrumentation>
+class Signal : private SlotBase::Owner
 {
 public:
     using Slot = signals::Slot<Signature>;
 
+    using Group = int;
+
+    using Event = typename Slot::Event;
+
+    using allocator_type = typename Slot::allocator_type;
+
+    class Awaiter;
+
     Signal() = default;
 
+    explicit Signal(const allocator_type& allocator);
+
     Signal(const Signal&) = delete;
 
-    Signal(Signal&&) = default;
+    Signal(Signal&& other) noexcept;
 
-    ~Signal() = default;
+    ~Signal();
 
     Signal& operator=(const Signal&) = delete;
 
+    // The slots are taken over where they were allocated, so both signals must use the same
+    // memory resource
     Signal& operator=(Signal&& other) noexcept;
 
     void clear();
@@ -38,70 +68,844 @@ public:
 
     [[nodiscard]] auto num_slots() const;
 
-    auto connect(typename Slot::Callable callable);
+    // Connect to the default group 0
+    template<typename Fn>
+    auto connect(Fn&& fn);
+
+    // Connect after the slots of the group, and before the slots of the groups after it
+    template<typename Fn>
+    auto connect(Group group, Fn&& fn);
+
+    // Connect a slot that is disconnected once the tracked object has been destroyed
+    template<typename Fn>
+    auto connect(Fn&& fn, Tracked tracked);
 
+    template<typename Fn>
+    auto connect(Group group, Fn&& fn, Tracked tracked);
+
+    // Connect the member function `Method` of the object, tracking the object
+    template<auto Method, typename T>
+    auto connect(const std::shared_ptr<T>& object);
+
+    // Emit passing the arguments to the slots by const reference, converted once
     template<typename... Args>
     auto operator()(Args&&... args) const;
 
+    // Emit passing the arguments to the combiner as rvalues. The default combiner moves
+    // them to the last slot, which saves a copy for a last slot taking them by value.
+    template<typename... Args>
+    auto emit_moving(Args&&... args) const;
+
+    // Emit the events visiting every slot only once, so each slot gets all the events before
+    // the next slot gets any. Slots taking a batch of events get all of them in one call,
+    // others are called once per event.
+    void emit_batch(std::span<const Event> events) const
+        requires std::is_void_v<typename Slot::Result>;
+
+    // Awaitable resuming the awaiting coroutine with the event of the next emission, before
+    // the slots are invoked. The awaiter is the registration, so awaiting does not allocate.
+    // Only signals whose arguments can be copied into an event can be awaited.
+    [[nodiscard]] Awaiter next() noexcept
+        requires Slot::copyableEvent;
+
+    // Awaitable resuming the awaiting coroutine on the executor
+    [[nodiscard]] Awaiter next(Executor& executor) noexcept
+        requires Slot::copyableEvent;
+
+    [[nodiscard]] Instrumentation& instrumentation() noexcept;
+
+    [[nodiscard]] const Instrumentation& instrumentation() const noexcept;
+
 private:
-    using Slots = std::vector<std::shared_ptr<Slot>>;
+    using Slots = std::pmr::vector<IntrusivePtr<Slot>>;
+
+    class Emission;
+
+    class TimedSlot;
+
+    struct Untimed
+    {
+        Untimed() = default;
+
+        explicit Untimed(const allocator_type&) noexcept
+        {
+        }
+    };
+
+    // Slots timed by the instrumentation, by the index of the slot
+    using TimedSlots =
+        std::conditional_t<Instrumentation::enabled, std::pmr::vector<TimedSlot>, Untimed>;
+
+    [[nodiscard]] auto activeSlots() const;
+
+    template<typename Fn>
+    Slot& insert(Group group, Fn&& fn);
+
+    template<typename... Args>
+    auto emit(Args&&... args) const;
+
+    // Whether to invoke a slot reached while emitting, locking its tracked object until it
+    // has been invoked. A slot whose tracked object has been destroyed is disconnected.
+    [[nodiscard]] static bool invocable(Slot& slot, Emission& emission);
+
+    void attachSlots() noexcept;
+
+    // Take over the coroutines awaiting the other signal
+    void adoptAwaiters(Signal& other) noexcept;
+
+    // Take over the emissions of the other signal, which continue with the slots moved here
+    void adoptEmissions(Signal& other) noexcept;
+
+    // Hand the slots over to the emissions in progress, to be destroyed once the outermost
+    // of them has finished, when the signal is destroyed or assigned to by a slot
+    void retireEmissions() noexcept;
+
+    // Resume the coroutines that were awaiting when the emission started, oldest first.
+    // Each is unlinked before it is resumed, so it can await again or destroy the others,
+    // or the signal.
+    template<typename... Args>
+    void resumeAwaiters(const Emission& emission, const Args&... args) const;
+
+    void detachSlots() noexcept;
+
+    void disconnect(std::span<SlotBase* const> disconnected) override;
+
+    // Disconnect the slots whose tracked object has been destroyed, so that they are no
+    // longer counted as connected
+    void disconnectExpiredSlots() const;
 
     void removeDisconnectedSlots();
 
+    void orderSlots() noexcept;
+
+    void unlockSlots() const noexcept;
+
+    void orderSlot(std::size_t i) noexcept;
+
+    [[nodiscard]] bool emitting() const;
+
+    // Active slots are followed by disconnected slots kept for reuse.
+    // Slots disconnected after they were connected remain active until
+    // there are at least as many of them as there are connected slots.
+    // Slots connected while emitting are put in order once the emission has finished.
     Slots slots;
+    std::pmr::vector<Group> groups;
+    std::size_t active = 0;
+    std::size_t connected = 0;
+    mutable Emission* emission = nullptr;
+    bool unordered = false;
+    mutable bool tracking = false;
+    mutable Awaiter* awaiters = nullptr;
+    mutable Awaiter* lastAwaiter = nullptr;
+    mutable std::size_t wakeups = 0;
+    [[no_unique_address]] TimedSlots timed;
+    [[no_unique_address]] mutable Instrumentation metrics;
+};
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+class Signal<Signature, Combiner, Instrumentation>::Emission
+{
+public:
+    explicit Emission(const Signal& signal) noexcept :
+        signal(&signal),
+        outer(std::exchange(signal.emission, this)),
+        slots(&signal.slots),
+        timed(&signal.timed),
+        metrics(&signal.metrics)
+    {
+    }
+
+    Emission(const Emission&) = delete;
+
+    ~Emission()
+    {
+        if (!signal)
+            return;
+
+        signal->emission = outer;
+
+        if (outer)
+        {
+            outer->locking = outer->locking || locking;
+            return;
+        }
+
+        // Combiners that stop early leave the slots they selected last locked
+        if (locking)
+            signal->unlockSlots();
+
+        // Only a signal that is not const can have been connected to while emitting
+        if (signal->unordered)
+            const_cast<Signal&>(*signal).orderSlots();
+    }
+
+    Emission& operator=(const Emission&) = delete;
+
+private:
+    friend Signal;
+
+    friend TimedSlot;
+
+    // Whether the signal still exists, so that the remaining slots are invoked
+    [[nodiscard]] bool alive() const noexcept
+    {
+        return signal != nullptr;
+    }
+
+    const Signal* signal;
+    Emission* outer;
+    const Slots* slots;
+    const TimedSlots* timed;
+    Instrumentation* metrics;
+
+    // Whether a tracked object has been locked, for the outermost emission to unlock
+    bool locking = false;
+
+    // Slots of a signal destroyed while emitting, kept by the outermost emission
+    std::optional<Slots> retiredSlots;
+    std::optional<TimedSlots> retiredTimed;
+};
+
+// Slot of the signal at an index, calling the slot there through the instrumentation.
+// Combiners get these instead of the slots to have every call timed.
+template<typename Signature, typename Combiner, typename Instrumentation>
+class Signal<Signature, Combiner, Instrumentation>::TimedSlot
+{
+public:
+    explicit TimedSlot(std::size_t index) noexcept :
+        index(index)
+    {
+    }
+
+    const TimedSlot& operator*() const noexcept
+    {
+        return *this;
+    }
+
+    Slot* operator->() const noexcept
+    {
+        return (*emission->slots)[index].get();
+    }
+
+    // The timed slot can be moved by a slot connecting while it is called, so the call is
+    // timed through the emission, which stays in place and forgets the metrics of a
+    // destroyed signal
+    template<typename... Args>
+    decltype(auto) operator()(Args&&... args) const
+    {
+        const auto& e = *emission;
+        const auto timer = detail::SlotTimer{e.metrics};
+        return std::invoke(*(*e.slots)[index], std::forward<Args>(args)...);
+    }
+
+private:
+    friend Signal;
+
+    // Emission that reached the slot last, set before the slot is handed to the combiner
+    mutable const Emission* emission = nullptr;
+    std::size_t index;
+};
+
+// Awaiter of the next emission, linked to the signal while the coroutine is suspended.
+// A coroutine awaiting a signal that is destroyed is not resumed.
+template<typename Signature, typename Combiner, typename Instrumentation>
+class Signal<Signature, Combiner, Instrumentation>::Awaiter
+{
+public:
+    Awaiter(Signal& signal, Executor* executor) noexcept :
+        signal(&signal),
+        executor(executor)
+    {
+    }
+
+    Awaiter(const Awaiter&) = delete;
+
+    ~Awaiter()
+    {
+        unlink();
+    }
+
+    Awaiter& operator=(const Awaiter&) = delete;
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> coroutine) noexcept
+    {
+        handle = coroutine;
+        wakeup = signal->wakeups;
+        before = std::exchange(signal->lastAwaiter, this);
+        (before ? before->after : signal->awaiters) = this;
+    }
+
+    Event await_resume()
+    {
+        return std::move(*event);
+    }
+
+private:
+    friend Signal;
+
+    void unlink() noexcept
+    {
+        if (!signal || !handle)
+            return;
+
+        (before ? before->after : signal->awaiters) = after;
+        (after ? after->before : signal->lastAwaiter) = before;
+        signal = nullptr;
+    }
+
+    template<typename... Args>
+    void resume(const Args&... args)
+    {
+        unlink();
+        event.emplace(args...);
+
+        if (executor)
+            executor->post([coroutine = handle] {
+                coroutine.resume();
+            });
+        else
+            handle.resume();
+    }
+
+    const Signal* signal;
+    Executor* executor;
+    std::coroutine_handle<> handle;
+    std::size_t wakeup = 0;
+    Awaiter* before = nullptr;
+    Awaiter* after = nullptr;
+    std::optional<Event> event;
 };
 
-template<typename Signature, typename Combiner>
-auto Signal<Signature, Combiner>::operator=(Signal&& other) noexcept -> Signal&
+template<typename Signature, typename Combiner, typename Instrumentation>
+Signal<Signature, Combiner, Instrumentation>::Signal(const allocator_type& allocator) :
+    slots(allocator),
+    groups(allocator),
+    timed(allocator)
+{
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+Signal<Signature, Combiner, Instrumentation>::Signal(Signal&& other) noexcept :
+    slots(std::move(other.slots)),
+    groups(std::move(other.groups)),
+    active(std::exchange(other.active, 0)),
+    connected(std::exchange(other.connected, 0)),
+    tracking(std::exchange(other.tracking, false)),
+    timed(std::move(other.timed))
+{
+    attachSlots();
+    adoptAwaiters(other);
+    adoptEmissions(other);
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+Signal<Signature, Combiner, Instrumentation>::~Signal()
+{
+    clear();
+    detachSlots();
+    retireEmissions();
+
+    while (awaiters)
+        awaiters->unlink();
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+auto Signal<Signature, Combiner, Instrumentation>::operator=(Signal&& other) noexcept
+    -> Signal&
 {
     if (this == &other)
         return *this;
 
+    clear();
+    detachSlots();
+    retireEmissions();
     slots = std::move(other.slots);
+    groups = std::move(other.groups);
+    active = std::exchange(other.active, 0);
+    connected = std::exchange(other.connected, 0);
+    tracking = std::exchange(other.tracking, false);
+    timed = std::move(other.timed);
+    attachSlots();
+    adoptAwaiters(other);
+    adoptEmissions(other);
     return *this;
 }
 
-template<typename Signature, typename Combiner>
-void Signal<Signature, Combiner>::clear()
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::clear()
+{
+    // Slots are destroyed with the signal, which clears the connections to them
+    for (auto& slot : activeSlots())
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    // Slots that are still being invoked are removed later
+    if (!emitting())
+    {
+        detachSlots();
+        slots.clear();
+        groups.clear();
+        active = 0;
+    }
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+bool Signal<Signature, Combiner, Instrumentation>::empty() const
+{
+    disconnectExpiredSlots();
+    return connected == 0;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+auto Signal<Signature, Combiner, Instrumentation>::num_slots() const
+{
+    disconnectExpiredSlots();
+    return static_cast<std::ptrdiff_t>(connected);
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename Fn>
+auto Signal<Signature, Combiner, Instrumentation>::connect(Fn&& fn)
+{
+    return connect(Group{0}, std::forward<Fn>(fn));
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename Fn>
+auto Signal<Signature, Combiner, Instrumentation>::connect(Group group, Fn&& fn)
+{
+    return Connection{insert(group, std::forward<Fn>(fn))};
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename Fn>
+auto Signal<Signature, Combiner, Instrumentation>::connect(Fn&& fn, Tracked tracked)
+{
+    return connect(Group{0}, std::forward<Fn>(fn), std::move(tracked));
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename Fn>
+auto Signal<Signature, Combiner, Instrumentation>::connect(
+    Group group, Fn&& fn, Tracked tracked)
+{
+    auto& slot = insert(group, std::forward<Fn>(fn));
+    slot.track(std::move(tracked.object));
+    tracking = true;
+    return Connection{slot};
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<auto Method, typename T>
+auto Signal<Signature, Combiner, Instrumentation>::connect(const std::shared_ptr<T>& object)
+{
+    return connect(bind<Method>(*object), track(object));
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename Fn>
+auto Signal<Signature, Combiner, Instrumentation>::insert(Group group, Fn&& fn) -> Slot&
+{
+    // Removing the disconnected slots only when at least half of the active slots are
+    // disconnected keeps the cost of connecting amortized constant
+    if (!emitting() && active - connected >= connected)
+        removeDisconnectedSlots();
+
+    if (active == slots.size())
+    {
+        if constexpr (Instrumentation::enabled)
+            if (timed.size() == slots.size())
+                timed.emplace_back(timed.size());
+
+        groups.push_back(group);
+
+        try
+        {
+            auto allocator = allocator_type{slots.get_allocator()};
+            slots.push_back(
+                IntrusivePtr<Slot>{allocator.template new_object<Slot>(std::forward<Fn>(fn))});
+        }
+        catch (...)
+        {
+            groups.pop_back();
+            throw;
+        }
+
+        slots.back()->attach(&connected, this);
+    }
+    else
+    {
+        slots[active]->reconnect(std::forward<Fn>(fn));
+        groups[active] = group;
+    }
+
+    auto& slot = *slots[active];
+
+    // Slots are accessed by index while emitting, so they cannot be moved until it finishes
+    if (active > 0 && groups[active - 1] > group)
+    {
+        if (emitting())
+            unordered = true;
+        else
+            orderSlot(active);
+    }
+
+    ++active;
+
+    if (slot.connected())
+        ++connected;
+
+    return slot;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+auto Signal<Signature, Combiner, Instrumentation>::activeSlots() const
+{
+    return std::views::counted(slots.begin(), static_cast<std::ptrdiff_t>(active));
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::attachSlots() noexcept
+{
+    for (auto& slot : slots)
+        slot->attach(&connected, this);
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::adoptAwaiters(Signal& other) noexcept
 {
+    for (auto awaiter = other.awaiters; awaiter; awaiter = awaiter->after)
+    {
+        awaiter->signal = this;
+        awaiter->wakeup = wakeups;
+    }
+
+    if (!other.awaiters)
+        return;
+
+    (lastAwaiter ? lastAwaiter->after : awaiters) = other.awaiters;
+    other.awaiters->before = lastAwaiter;
+    lastAwaiter = other.lastAwaiter;
+    other.awaiters = other.lastAwaiter = nullptr;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::adoptEmissions(Signal& other) noexcept
+{
+    emission = std::exchange(other.emission, nullptr);
+    unordered = std::exchange(other.unordered, false);
+
+    for (auto e = emission; e; e = e->outer)
+    {
+        e->signal = this;
+        e->slots = &slots;
+        e->timed = &timed;
+        e->metrics = &metrics;
+    }
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::retireEmissions() noexcept
+{
+    if (!emission)
+        return;
+
+    auto outermost = emission;
+
+    while (outermost->outer)
+        outermost = outermost->outer;
+
+    // Moving the vectors keeps the slots and the timed slots where the emissions refer to
+    auto& retiredSlots = outermost->retiredSlots.emplace(std::move(slots));
+    auto& retiredTimed = outermost->retiredTimed.emplace(std::move(timed));
+
+    for (auto e = std::exchange(emission, nullptr); e; e = e->outer)
+    {
+        e->signal = nullptr;
+        e->slots = &retiredSlots;
+        e->timed = &retiredTimed;
+        e->metrics = nullptr;
+    }
+
     slots.clear();
+    groups.clear();
+    active = 0;
+    unordered = false;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename... Args>
+void Signal<Signature, Combiner, Instrumentation>::resumeAwaiters(
+    const Emission& emission, const Args&... args) const
+{
+    const auto wakeup = ++wakeups;
+
+    while (emission.alive() && awaiters && awaiters->wakeup < wakeup)
+        awaiters->resume(args...);
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::detachSlots() noexcept
+{
+    for (auto& slot : slots)
+        slot->attach(nullptr, nullptr);
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::disconnect(
+    std::span<SlotBase* const> disconnected)
+{
+    for (auto slot : disconnected)
+        static_cast<Disconnectable&>(*slot).disconnect();
+
+    // Slots that are still being invoked are removed later
+    if (!emitting())
+        removeDisconnectedSlots();
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::disconnectExpiredSlots() const
+{
+    // Only the signals that have tracked slots look for the expired ones
+    if (!tracking)
+        return;
+
+    tracking = false;
+
+    for (auto& slot : activeSlots())
+    {
+        if (slot->expired())
+            static_cast<Disconnectable&>(*slot).disconnect();
+        else if (slot->tracks())
+            tracking = true;
+    }
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::removeDisconnectedSlots()
+{
+    disconnectExpiredSlots();
+
+    // Move the connected slots to the front keeping their order
+    auto kept = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < active; ++i)
+        if (slots[i]->connected())
+        {
+            std::ranges::swap(slots[kept], slots[i]);
+            std::ranges::swap(groups[kept++], groups[i]);
+        }
+
+    active = kept;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::orderSlots() noexcept
+{
+    for (auto i = std::size_t{1}; i < active; ++i)
+        if (groups[i - 1] > groups[i])
+            orderSlot(i);
+
+    unordered = false;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::unlockSlots() const noexcept
+{
+    for (auto& slot : slots)
+        slot->unlockTracked();
 }
 
-template<typename Signature, typename Combiner>
-bool Signal<Signature, Combiner>::empty() const
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::orderSlot(std::size_t i) noexcept
 {
-    return std::ranges::none_of(slots, std::mem_fn(&Slot::connected));
+    // Move the slot after the slots of the same group before it, which are in order
+    const auto from = static_cast<std::ptrdiff_t>(i);
+    const auto to = std::upper_bound(groups.begin(), groups.begin() + from, groups[i]) -
+        groups.begin();
+
+    std::rotate(slots.begin() + to, slots.begin() + from, slots.begin() + from + 1);
+    std::rotate(groups.begin() + to, groups.begin() + from, groups.begin() + from + 1);
 }
 
-template<typename Signature, typename Combiner>
-auto Signal<Signature, Combiner>::num_slots() const
+template<typename Signature, typename Combiner, typename Instrumentation>
+bool Signal<Signature, Combiner, Instrumentation>::emitting() const
 {
-    return std::ranges::count_if(slots, std::mem_fn(&Slot::connected));
+    return emission != nullptr;
 }
 
-template<typename Signature, typename Combiner>
-auto Signal<Signature, Combiner>::connect(typename Slot::Callable callable)
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename... Args>
+inline auto Signal<Signature, Combiner, Instrumentation>::operator()(Args&&... args) const
 {
-    removeDisconnectedSlots();
-    return Connection{slots.emplace_back(std::make_shared<Slot>(std::move(callable)))};
+    return Arguments<Signature>::share(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
 }
 
-template<typename Signature, typename Combiner>
-void Signal<Signature, Combiner>::removeDisconnectedSlots()
+template<typename Signature, typename Combiner, typename Instrumentation>
+template<typename... Args>
+inline auto Signal<Signature, Combiner, Instrumentation>::emit_moving(Args&&... args) const
 {
-    std::erase_if(slots, std::not_fn(std::mem_fn(&Slot::connected)));
+    return Arguments<Signature>::own(
+        [this](auto&&... args) {
+            return emit(std::forward<decltype(args)>(args)...);
+        },
+        std::forward<Args>(args)...);
 }
 
-template<typename Signature, typename Combiner>
+template<typename Signature, typename Combiner, typename Instrumentation>
 template<typename... Args>
-inline auto Signal<Signature, Combiner>::operator()(Args&&... args) const
+inline auto Signal<Signature, Combiner, Instrumentation>::emit(Args&&... args) const
 {
-    const auto immutable = slots;
+    // Slots are accessed by index so that slots connected while emitting neither
+    // invalidate the iteration nor get invoked, and nothing is removed until
+    // the outermost emission has finished. The slots are reached through the emission,
+    // which keeps them if a slot destroys the signal, and then invokes no more of them.
+    auto emission = Emission{*this};
+
+    if constexpr (Instrumentation::enabled)
+        metrics.emitted();
+
+    if constexpr (Slot::copyableEvent)
+        if (awaiters)
+            resumeAwaiters(emission, args...);
+
+    if constexpr (Instrumentation::enabled)
+    {
+        const auto slot = [&emission](std::size_t i) -> const TimedSlot& {
+            const auto& timedSlot = (*emission.timed)[i];
+            timedSlot.emission = &emission;
+            return timedSlot;
+        };
+
+        return std::invoke(
+            Combiner{},
+            std::views::iota(std::size_t{0}, emission.alive() ? active : 0) |
+                std::views::filter([&emission](std::size_t i) {
+                    if (!emission.alive())
+                        return false;
+
+                    if (invocable(*(*emission.slots)[i], emission))
+                        return true;
+
+                    emission.metrics->skipped();
+                    return false;
+                }) |
+                std::views::transform(slot),
+            std::forward<Args>(args)...);
+    }
+
+    const auto slot = [&emission](std::size_t i) -> const auto& {
+        return (*emission.slots)[i];
+    };
+
     return std::invoke(
-        Combiner{}, immutable | std::views::filter(std::mem_fn(&Slot::connected)),
+        Combiner{},
+        std::views::iota(std::size_t{0}, emission.alive() ? active : 0) |
+            std::views::filter([&emission](std::size_t i) {
+                return emission.alive() && invocable(*(*emission.slots)[i], emission);
+            }) |
+            std::views::transform(slot),
         std::forward<Args>(args)...);
 }
 
+template<typename Signature, typename Combiner, typename Instrumentation>
+inline bool Signal<Signature, Combiner, Instrumentation>::invocable(
+    Slot& slot, Emission& emission)
+{
+    if (slot.expired())
+    {
+        static_cast<Disconnectable&>(slot).disconnect();
+        return false;
+    }
+
+    if (!slot.enabled())
+        return false;
+
+    if (!slot.tracks())
+        return true;
+
+    if (slot.lockTracked())
+    {
+        emission.locking = true;
+        return true;
+    }
+
+    static_cast<Disconnectable&>(slot).disconnect();
+    return false;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+void Signal<Signature, Combiner, Instrumentation>::emit_batch(
+    std::span<const Event> events) const
+    requires std::is_void_v<typename Slot::Result>
+{
+    if (events.empty())
+        return;
+
+    auto emission = Emission{*this};
+
+    if constexpr (Instrumentation::enabled)
+        metrics.emitted();
+
+    if constexpr (Slot::copyableEvent)
+        for (const auto& event : events)
+            if (emission.alive() && awaiters)
+                resumeAwaiters(emission, event);
+
+    const auto slotCount = emission.alive() ? active : 0;
+
+    for (auto i = std::size_t{0}; i < slotCount && emission.alive(); ++i)
+    {
+        if (auto& slot = *(*emission.slots)[i]; invocable(slot, emission))
+        {
+            if constexpr (Instrumentation::enabled)
+            {
+                const auto timer = detail::SlotTimer{emission.metrics};
+                slot.deliver(events);
+            }
+            else
+                slot.deliver(events);
+        }
+        else if constexpr (Instrumentation::enabled)
+            emission.metrics->skipped();
+    }
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+auto Signal<Signature, Combiner, Instrumentation>::next() noexcept -> Awaiter
+    requires Slot::copyableEvent
+{
+    return Awaiter{*this, nullptr};
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+auto Signal<Signature, Combiner, Instrumentation>::next(Executor& executor) noexcept -> Awaiter
+    requires Slot::copyableEvent
+{
+    return Awaiter{*this, &executor};
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+Instrumentation& Signal<Signature, Combiner, Instrumentation>::instrumentation() noexcept
+{
+    return metrics;
+}
+
+template<typename Signature, typename Combiner, typename Instrumentation>
+const Instrumentation& Signal<Signature, Combiner, Instrumentation>::instrumentation()
+    const noexcept
+{
+    return metrics;
+}
+
 } // namespace signals
 
 #endif
@@ -3,8 +3,12 @@
 #ifndef SIGNALS_SLOT_HPP_
 #define SIGNALS_SLOT_HPP_
 
-#include "Disconnectable.hpp"
-#include <functional>
+#include "Function.hpp"
+#include "SlotBase.hpp"
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
 
 namespace signals
 {
@@ -12,15 +16,71 @@ namespace signals
 template<typename>
 class Slot;
 
+namespace detail
+{
+
+// Arguments of a single emission stored by value, the argument itself if there is only one
+template<typename... Args>
+struct EventType
+{
+    using type = std::tuple<std::remove_cvref_t<Args>...>;
+};
+
+template<typename Arg>
+struct EventType<Arg>
+{
+    using type = std::remove_cvref_t<Arg>;
+};
+
+// Callables taking a batch of events instead of the arguments of a single emission
+// are called once per batch, and with a batch of one for a single emission
+template<typename Fn, typename R, typename... Args>
+concept BatchTarget = std::is_void_v<R> &&
+    !std::is_constructible_v<Function<R(Args...)>, Fn> &&
+    std::is_constructible_v<
+        Function<void(std::span<const typename EventType<Args...>::type>)>, Fn>;
+
+template<typename Fn, typename R, typename... Args>
+concept SlotTarget =
+    std::is_constructible_v<Function<R(Args...)>, Fn> || BatchTarget<Fn, R, Args...>;
+
+} // namespace detail
+
 template<typename R, typename... Args>
-class Slot<R(Args...)> : public Disconnectable
+class Slot<R(Args...)> : public SlotBase
 {
 public:
-    using Callable = std::function<R(Args...)>;
+    using Callable = Function<R(Args...)>;
 
     using Result = R;
 
-    explicit Slot(Callable callable);
+    using Event = typename detail::EventType<Args...>::type;
+
+    // Whether an emission can be stored as an event by copying its arguments
+    static constexpr bool copyableEvent = std::is_constructible_v<Event, const Args&...>;
+
+    using Batch = std::span<const Event>;
+
+    using BatchCallable = Function<void(Batch)>;
+
+    using allocator_type = typename Callable::allocator_type;
+
+    template<typename Fn>
+    static constexpr bool batched = detail::BatchTarget<Fn, R, Args...>;
+
+    // Whether the callable is stored in the slot without allocating
+    template<typename Fn>
+    static constexpr bool storedInline = batched<Fn>
+        ? BatchCallable::template storedInline<std::decay_t<Fn>>
+        : Callable::template storedInline<std::decay_t<Fn>>;
+
+    template<typename Fn>
+        requires detail::SlotTarget<Fn, R, Args...>
+    explicit Slot(Fn&& fn);
+
+    template<typename Fn>
+        requires detail::SlotTarget<Fn, R, Args...>
+    Slot(std::allocator_arg_t, const allocator_type& allocator, Fn&& fn);
 
     Slot(const Slot&) = delete;
 
@@ -32,38 +92,265 @@ public:
 
     Slot& operator=(Slot&&) = delete;
 
-    R operator()(Args... args) const;
+    R operator()(Argument<Args>... args) const;
+
+    // Call moving the arguments to the callable, for example when this is the last slot
+    R operator()(Args&&... args) const
+        requires(std::is_object_v<Args> || ...);
+
+    // Call a batched callable once with all the events, others once per event
+    void deliver(Batch events) const
+        requires std::is_void_v<R>;
 
+    // Whether the slot has a callable, and its tracked object, if any, has not been destroyed
     [[nodiscard]] bool connected() const override;
 
+    [[nodiscard]] bool blocked() const override;
+
+    // Whether the slot is connected and not blocked, that is, invoked when emitting
+    [[nodiscard]] bool enabled() const;
+
+    // Tie the slot to the lifetime of the object. Whoever invokes the slot locks the object
+    // first with `lockTracked()`, and does not invoke the slot if that fails.
+    void track(std::weak_ptr<const void> object);
+
+    // Whether the slot is tied to the lifetime of an object
+    [[nodiscard]] bool tracks() const;
+
+    // Whether the tracked object has been destroyed while the slot is connected
+    [[nodiscard]] bool expired() const;
+
+    // Keep the tracked object alive until the slot has next been invoked, blocked or
+    // unlocked. Returns false if the object has been destroyed, and true if there is no
+    // tracked object.
+    [[nodiscard]] bool lockTracked() const;
+
+    // Stop keeping the tracked object alive for an invocation that did not happen
+    void unlockTracked() const noexcept;
+
+    template<typename Fn>
+        requires detail::SlotTarget<Fn, R, Args...>
+    void reconnect(Fn&& fn);
+
+    void attach(std::size_t* connectedSlots, Owner* owner) noexcept;
+
 private:
+    template<typename Fn>
+    void assign(Fn&& fn);
+
+    [[nodiscard]] std::shared_ptr<const void> releaseTracked() const;
+
     void disconnect() override;
 
+    void block() override;
+
+    void unblock() override;
+
+    void destroy() noexcept override;
+
+    allocator_type allocator;
     Callable callable;
+    BatchCallable batch;
+    std::size_t* connectedSlots = nullptr;
+    std::size_t blocks = 0;
+    std::weak_ptr<const void> tracked;
+    mutable std::shared_ptr<const void> locked;
+    bool tracking = false;
 };
 
 template<typename R, typename... Args>
-Slot<R(Args...)>::Slot(Callable callable) :
-    callable(std::move(callable))
+template<typename Fn>
+    requires detail::SlotTarget<Fn, R, Args...>
+Slot<R(Args...)>::Slot(Fn&& fn) :
+    Slot(std::allocator_arg, allocator_type{}, std::forward<Fn>(fn))
 {
 }
 
+template<typename R, typename... Args>
+template<typename Fn>
+    requires detail::SlotTarget<Fn, R, Args...>
+Slot<R(Args...)>::Slot(std::allocator_arg_t, const allocator_type& allocator, Fn&& fn) :
+    allocator(allocator)
+{
+    assign(std::forward<Fn>(fn));
+}
+
 template<typename R, typename... Args>
 bool Slot<R(Args...)>::connected() const
 {
-    return callable != nullptr;
+    return callable != nullptr && !expired();
+}
+
+template<typename R, typename... Args>
+bool Slot<R(Args...)>::blocked() const
+{
+    return blocks != 0;
+}
+
+template<typename R, typename... Args>
+inline bool Slot<R(Args...)>::enabled() const
+{
+    return connected() && blocks == 0;
+}
+
+template<typename R, typename... Args>
+void Slot<R(Args...)>::track(std::weak_ptr<const void> object)
+{
+    tracked = std::move(object);
+    tracking = true;
+}
+
+template<typename R, typename... Args>
+inline bool Slot<R(Args...)>::tracks() const
+{
+    return tracking;
+}
+
+template<typename R, typename... Args>
+inline bool Slot<R(Args...)>::expired() const
+{
+    return tracking && tracked.expired();
+}
+
+template<typename R, typename... Args>
+inline bool Slot<R(Args...)>::lockTracked() const
+{
+    if (!tracking)
+        return true;
+
+    locked = tracked.lock();
+    return locked != nullptr;
+}
+
+template<typename R, typename... Args>
+inline void Slot<R(Args...)>::unlockTracked() const noexcept
+{
+    locked.reset();
+}
+
+template<typename R, typename... Args>
+template<typename Fn>
+    requires detail::SlotTarget<Fn, R, Args...>
+void Slot<R(Args...)>::reconnect(Fn&& fn)
+{
+    recycle();
+    blocks = 0;
+    tracking = false;
+    assign(std::forward<Fn>(fn));
+}
+
+template<typename R, typename... Args>
+void Slot<R(Args...)>::attach(std::size_t* connectedSlots, Owner* owner) noexcept
+{
+    this->connectedSlots = connectedSlots;
+    own(owner);
+}
+
+template<typename R, typename... Args>
+template<typename Fn>
+void Slot<R(Args...)>::assign(Fn&& fn)
+{
+    if constexpr (batched<Fn>)
+    {
+        batch = BatchCallable{std::allocator_arg, allocator, std::forward<Fn>(fn)};
+
+        // The slot is neither copied nor moved, so the callable can refer to it
+        if (batch)
+            callable = [this](Argument<Args>... args) {
+                const auto event = Event{args...};
+                std::invoke(batch, Batch{&event, 1});
+            };
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Fn>, Callable>)
+        callable = std::move(fn);
+    else
+        callable = Callable{std::allocator_arg, allocator, std::forward<Fn>(fn)};
 }
 
 template<typename R, typename... Args>
 void Slot<R(Args...)>::disconnect()
 {
+    // A slot whose tracked object has been destroyed is not connected, but it is counted
+    // by the signal until it is disconnected
+    if (callable == nullptr)
+        return;
+
     callable = nullptr;
+    batch = nullptr;
+    tracked.reset();
+    locked.reset();
+    tracking = false;
+
+    if (connectedSlots)
+        --*connectedSlots;
 }
 
 template<typename R, typename... Args>
-R Slot<R(Args...)>::operator()(Args... args) const
+void Slot<R(Args...)>::block()
 {
-    return std::invoke(callable, args...);
+    ++blocks;
+    locked.reset();
+}
+
+template<typename R, typename... Args>
+void Slot<R(Args...)>::unblock()
+{
+    if (blocks != 0)
+        --blocks;
+}
+
+template<typename R, typename... Args>
+void Slot<R(Args...)>::destroy() noexcept
+{
+    // Slots are allocated from the memory resource of their allocator
+    auto a = allocator;
+    a.delete_object(this);
+}
+
+template<typename R, typename... Args>
+inline std::shared_ptr<const void> Slot<R(Args...)>::releaseTracked() const
+{
+    if (!tracking)
+        return nullptr;
+
+    return std::move(locked);
+}
+
+template<typename R, typename... Args>
+R Slot<R(Args...)>::operator()(Argument<Args>... args) const
+{
+    const auto object = releaseTracked();
+    return callable.call(std::forward<Argument<Args>>(args)...);
+}
+
+template<typename R, typename... Args>
+R Slot<R(Args...)>::operator()(Args&&... args) const
+    requires(std::is_object_v<Args> || ...)
+{
+    const auto object = releaseTracked();
+    return std::invoke(callable, std::forward<Args>(args)...);
+}
+
+template<typename R, typename... Args>
+void Slot<R(Args...)>::deliver(Batch events) const
+    requires std::is_void_v<R>
+{
+    const auto object = releaseTracked();
+
+    if (batch)
+        return std::invoke(batch, events);
+
+    // Stop if a slot disconnects or blocks this one in the middle of the batch
+    for (const auto& event : events)
+    {
+        if (!enabled())
+            return;
+
+        if constexpr (sizeof...(Args) == 1)
+            callable.call(event);
+        else
+            std::apply([this](const auto&... args) { callable.call(args...); }, event);
+    }
 }
 
 } // namespace signals
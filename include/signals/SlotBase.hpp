@@ -0,0 +1,109 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_SLOTBASE_HPP_
+#define SIGNALS_SLOTBASE_HPP_
+
+#include "Disconnectable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace signals
+{
+
+// Intrusively reference counted slot that can be recycled for a new connection.
+// Each recycle starts a new generation, which invalidates connections to the previous one.
+class SlotBase : public Disconnectable
+{
+public:
+    using Generation = std::uint32_t;
+
+    class Owner;
+
+    class Reference;
+
+    SlotBase() = default;
+
+    SlotBase(const SlotBase&) = delete;
+
+    SlotBase(SlotBase&&) = delete;
+
+    ~SlotBase() override;
+
+    SlotBase& operator=(const SlotBase&) = delete;
+
+    SlotBase& operator=(SlotBase&&) = delete;
+
+    [[nodiscard]] Generation generation() const noexcept;
+
+    void retain() noexcept;
+
+    void release() noexcept;
+
+    // The signal the slot is attached to, if any
+    [[nodiscard]] Owner* owner() const noexcept;
+
+protected:
+    void recycle() noexcept;
+
+    void own(Owner* owner) noexcept;
+
+private:
+    virtual void destroy() noexcept;
+
+    friend Reference;
+
+    std::size_t references = 0;
+    Generation current = 0;
+    Reference* referrers = nullptr;
+    Owner* owning = nullptr;
+};
+
+// Signal owning slots, which disconnects many of its slots at once
+class SlotBase::Owner
+{
+public:
+    // Disconnect the slots, all owned by this, removing the disconnected slots only once
+    virtual void disconnect(std::span<SlotBase* const> slots) = 0;
+
+protected:
+    ~Owner() = default;
+};
+
+// Reference to a slot that does not keep the slot alive and is cleared when the slot is
+// destroyed. The references to a slot are linked to it, so referring does not allocate.
+class SlotBase::Reference
+{
+public:
+    Reference() noexcept = default;
+
+    explicit Reference(SlotBase& slot) noexcept;
+
+    Reference(const Reference& other) noexcept;
+
+    Reference(Reference&& other) noexcept;
+
+    ~Reference();
+
+    Reference& operator=(const Reference& other) noexcept;
+
+    Reference& operator=(Reference&& other) noexcept;
+
+    // The slot, or null once it has been destroyed
+    [[nodiscard]] SlotBase* get() const noexcept;
+
+private:
+    friend SlotBase;
+
+    void link(SlotBase* slot) noexcept;
+
+    void unlink() noexcept;
+
+    SlotBase* slot = nullptr;
+    Reference* before = nullptr;
+    Reference* after = nullptr;
+};
+
+} // namespace signals
+
+#endif
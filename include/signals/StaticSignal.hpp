@@ -0,0 +1,111 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_STATICSIGNAL_HPP_
+#define SIGNALS_STATICSIGNAL_HPP_
+
+#include "Arguments.hpp"
+#include "Combiner.hpp"
+#include "Slot.hpp"
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+namespace signals
+{
+
+template<typename Signature, typename Combiner, auto... Fns>
+class BasicStaticSignal;
+
+// Signal with a fixed set of slots known at compile time
+//
+// The slots are function pointers or captureless lambdas given as template arguments.
+// Nothing is stored nor allocated, and with the default combiner an emission is a sequence
+// of direct calls to the slots that the compiler can inline.
+template<typename Signature, auto... Fns>
+using StaticSignal =
+    BasicStaticSignal<Signature, DefaultCombiner<typename Slot<Signature>::Result>, Fns...>;
+
+// Static signal with a custom combiner, which gets a range of pointers to functions
+// calling the slots directly
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+class BasicStaticSignal<R(Args...), Combiner, Fns...>
+{
+public:
+    static_assert(
+        (std::is_invocable_v<decltype(Fns), Argument<Args>...> && ...),
+        "Slots must be invocable with the arguments of the signature");
+
+    using Slot = R (*)(Argument<Args>...);
+
+    [[nodiscard]] static constexpr bool empty() noexcept;
+
+    [[nodiscard]] static constexpr std::size_t num_slots() noexcept;
+
+    template<typename... As>
+    auto operator()(As&&... args) const;
+
+private:
+    template<auto Fn>
+    static R call(Argument<Args>... args);
+
+    static R emit(Argument<Args>... args);
+
+    static constexpr auto slots = std::array<Slot, sizeof...(Fns)>{&call<Fns>...};
+};
+
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+constexpr bool BasicStaticSignal<R(Args...), Combiner, Fns...>::empty() noexcept
+{
+    return sizeof...(Fns) == 0;
+}
+
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+constexpr std::size_t BasicStaticSignal<R(Args...), Combiner, Fns...>::num_slots() noexcept
+{
+    return sizeof...(Fns);
+}
+
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+template<typename... As>
+inline auto BasicStaticSignal<R(Args...), Combiner, Fns...>::operator()(As&&... args) const
+{
+    if constexpr (std::is_same_v<Combiner, DefaultCombiner<R>>)
+        return Arguments<R(Args...)>::share(&emit, std::forward<As>(args)...);
+    else
+        return Arguments<R(Args...)>::share(
+            [](Argument<Args>... args) {
+                return std::invoke(
+                    Combiner{}, std::span{slots}, std::forward<Argument<Args>>(args)...);
+            },
+            std::forward<As>(args)...);
+}
+
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+template<auto Fn>
+inline R BasicStaticSignal<R(Args...), Combiner, Fns...>::call(Argument<Args>... args)
+{
+    if constexpr (std::is_void_v<R>)
+        std::invoke(Fn, std::forward<Argument<Args>>(args)...);
+    else
+        return std::invoke(Fn, std::forward<Argument<Args>>(args)...);
+}
+
+template<typename R, typename... Args, typename Combiner, auto... Fns>
+inline R BasicStaticSignal<R(Args...), Combiner, Fns...>::emit(Argument<Args>... args)
+{
+    // Same as the default combiner, but unrolled at compile time
+    if constexpr (std::is_void_v<R>)
+        (call<Fns>(args...), ...);
+    else
+    {
+        auto r = R{};
+        ((r = call<Fns>(args...)), ...);
+        return r;
+    }
+}
+
+} // namespace signals
+
+#endif
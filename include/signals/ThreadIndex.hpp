@@ -0,0 +1,27 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_THREADINDEX_HPP_
+#define SIGNALS_THREADINDEX_HPP_
+
+#include <atomic>
+#include <cstddef>
+
+namespace signals
+{
+namespace detail
+{
+
+inline constexpr std::size_t cacheLineSize = 64;
+
+// Small index of the calling thread, assigned on first use
+inline std::size_t threadIndex() noexcept
+{
+    static auto next = std::atomic<std::size_t>{0};
+    thread_local const auto index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace detail
+} // namespace signals
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_THREADPOOL_HPP_
+#define SIGNALS_THREADPOOL_HPP_
+
+#include "Executor.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace signals
+{
+
+// Work-stealing executor running the posted tasks on a fixed number of worker threads
+//
+// Each worker has a queue of its own. Tasks posted by a worker go to its own queue and
+// are run last in, first out, other tasks are distributed over the queues. A worker that
+// runs out of tasks steals the oldest task from the other queues. The tasks still pending
+// on destruction are run before the workers are joined.
+class ThreadPool : public Executor
+{
+public:
+    ThreadPool();
+
+    explicit ThreadPool(std::size_t threads);
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool(ThreadPool&&) = delete;
+
+    ~ThreadPool() override;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    // Pool with a thread per hardware thread shared by the whole program
+    [[nodiscard]] static ThreadPool& shared();
+
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    void post(Task task) override;
+
+    // Run a pending task on the calling thread, if any, to help while waiting for tasks
+    bool tryRun();
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    [[nodiscard]] std::size_t current() noexcept;
+
+    bool tryRun(std::size_t queue);
+
+    void work(std::stop_token stop, std::size_t queue);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::atomic<std::size_t> pending = 0;
+    std::atomic<std::size_t> next = 0;
+    std::atomic<std::size_t> sleeping = 0;
+    std::mutex mutex;
+    std::condition_variable_any available;
+    std::vector<std::jthread> workers;
+};
+
+} // namespace signals
+
+#endif
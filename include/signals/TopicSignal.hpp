@@ -0,0 +1,265 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_TOPICSIGNAL_HPP_
+#define SIGNALS_TOPICSIGNAL_HPP_
+
+#include "Signal.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace signals
+{
+
+// Signal emitted with a topic, invoking only the slots connected to that topic or to a
+// prefix of it
+//
+// Slots of a topic are found through a hash index and slots of a prefix through a trie, so
+// an emission costs the slots it invokes rather than all the slots. The slots of the
+// prefixes are invoked from the shortest prefix to the longest, and then the slots of the
+// topic. The slots of one topic or prefix are a Signal, with its connection semantics.
+// An emission invokes several signals, so the slots return nothing.
+template<typename Signature, typename Combiner = DefaultCombiner<void>>
+class TopicSignal
+{
+public:
+    using Signal = signals::Signal<Signature, Combiner>;
+
+    static_assert(
+        std::is_void_v<typename Signal::Slot::Result>, "Slots of topics must return void");
+
+    TopicSignal() = default;
+
+    TopicSignal(const TopicSignal&) = delete;
+
+    TopicSignal(TopicSignal&&) = default;
+
+    ~TopicSignal() = default;
+
+    TopicSignal& operator=(const TopicSignal&) = delete;
+
+    TopicSignal& operator=(TopicSignal&&) = default;
+
+    // Disconnect all the slots. Topics and prefixes still being emitted are freed once the
+    // emission has finished.
+    void clear();
+
+    [[nodiscard]] bool empty() const;
+
+    // Connect to the emissions of the topic
+    template<typename Fn>
+    auto connect(std::string_view topic, Fn&& fn);
+
+    // Connect to the emissions of every topic starting with the prefix, all for ""
+    template<typename Fn>
+    auto connect_prefix(std::string_view prefix, Fn&& fn);
+
+    template<typename... Args>
+    void operator()(std::string_view topic, Args&&... args) const;
+
+private:
+    class Emission;
+
+    struct Hash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view topic) const noexcept
+        {
+            return std::hash<std::string_view>{}(topic);
+        }
+    };
+
+    // Characters and nodes of the children of a node, sorted by the character
+    using Children = std::vector<std::pair<char, std::size_t>>;
+
+    struct Node
+    {
+        Children children;
+        Signal signal;
+    };
+
+    // The child of the character, or where to insert it
+    [[nodiscard]] static auto findChild(const Children& children, char c);
+
+    [[nodiscard]] Signal& prefixSignal(std::string_view prefix);
+
+    template<typename... Args>
+    void emitPrefixes(std::string_view topic, const Args&... args) const;
+
+    // Free the topics and prefixes left without slots by a clear while emitting
+    void removeCleared();
+
+    std::unordered_map<std::string, Signal, Hash, std::equal_to<>> topics;
+    std::deque<Node> prefixes;
+    mutable std::size_t emissions = 0;
+    bool cleared = false;
+};
+
+template<typename Signature, typename Combiner>
+class TopicSignal<Signature, Combiner>::Emission
+{
+public:
+    explicit Emission(const TopicSignal& signal) noexcept :
+        signal(signal)
+    {
+        ++signal.emissions;
+    }
+
+    Emission(const Emission&) = delete;
+
+    ~Emission()
+    {
+        // Only a signal that is not const can have been cleared while emitting
+        if (--signal.emissions == 0 && signal.cleared)
+            const_cast<TopicSignal&>(signal).removeCleared();
+    }
+
+    Emission& operator=(const Emission&) = delete;
+
+private:
+    const TopicSignal& signal;
+};
+
+template<typename Signature, typename Combiner>
+void TopicSignal<Signature, Combiner>::clear()
+{
+    if (emissions == 0)
+    {
+        topics.clear();
+        prefixes.clear();
+        return;
+    }
+
+    for (auto& topic : topics)
+        topic.second.clear();
+
+    for (auto& node : prefixes)
+        node.signal.clear();
+
+    cleared = true;
+}
+
+template<typename Signature, typename Combiner>
+bool TopicSignal<Signature, Combiner>::empty() const
+{
+    return std::ranges::all_of(topics, [](const auto& topic) {
+        return topic.second.empty();
+    }) && std::ranges::all_of(prefixes, [](const Node& node) {
+        return node.signal.empty();
+    });
+}
+
+template<typename Signature, typename Combiner>
+template<typename Fn>
+auto TopicSignal<Signature, Combiner>::connect(std::string_view topic, Fn&& fn)
+{
+    auto it = topics.find(topic);
+
+    if (it == topics.end())
+        it = topics.try_emplace(std::string{topic}).first;
+
+    return it->second.connect(std::forward<Fn>(fn));
+}
+
+template<typename Signature, typename Combiner>
+template<typename Fn>
+auto TopicSignal<Signature, Combiner>::connect_prefix(std::string_view prefix, Fn&& fn)
+{
+    return prefixSignal(prefix).connect(std::forward<Fn>(fn));
+}
+
+template<typename Signature, typename Combiner>
+template<typename... Args>
+void TopicSignal<Signature, Combiner>::operator()(std::string_view topic, Args&&... args) const
+{
+    const auto emission = Emission{*this};
+
+    if (!prefixes.empty())
+        emitPrefixes(topic, args...);
+
+    if (const auto it = topics.find(topic); it != topics.end() && !it->second.empty())
+        std::invoke(it->second, args...);
+}
+
+template<typename Signature, typename Combiner>
+auto TopicSignal<Signature, Combiner>::findChild(const Children& children, char c)
+{
+    return std::ranges::lower_bound(children, c, {}, &Children::value_type::first);
+}
+
+template<typename Signature, typename Combiner>
+auto TopicSignal<Signature, Combiner>::prefixSignal(std::string_view prefix) -> Signal&
+{
+    if (prefixes.empty())
+        prefixes.emplace_back();
+
+    auto node = std::size_t{0};
+
+    for (const auto c : prefix)
+    {
+        auto& children = prefixes[node].children;
+        const auto child = findChild(children, c);
+
+        if (child != children.end() && child->first == c)
+        {
+            node = child->second;
+            continue;
+        }
+
+        children.emplace(child, c, prefixes.size());
+        node = prefixes.size();
+        prefixes.emplace_back();
+    }
+
+    return prefixes[node].signal;
+}
+
+template<typename Signature, typename Combiner>
+template<typename... Args>
+void TopicSignal<Signature, Combiner>::emitPrefixes(
+    std::string_view topic, const Args&... args) const
+{
+    // Children are looked up after emitting, as the slots can connect to new prefixes
+    for (auto node = std::size_t{0}, length = std::size_t{0};; ++length)
+    {
+        if (const auto& signal = prefixes[node].signal; !signal.empty())
+            std::invoke(signal, args...);
+
+        if (length == topic.size())
+            return;
+
+        const auto& children = prefixes[node].children;
+        const auto child = findChild(children, topic[length]);
+
+        if (child == children.end() || child->first != topic[length])
+            return;
+
+        node = child->second;
+    }
+}
+
+template<typename Signature, typename Combiner>
+void TopicSignal<Signature, Combiner>::removeCleared()
+{
+    // Slots connected after the clear are kept
+    std::erase_if(topics, [](const auto& topic) {
+        return topic.second.empty();
+    });
+
+    if (std::ranges::all_of(prefixes, [](const Node& node) { return node.signal.empty(); }))
+        prefixes.clear();
+
+    cleared = false;
+}
+
+} // namespace signals
+
+#endif
@@ -0,0 +1,25 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_TRACKED_HPP_
+#define SIGNALS_TRACKED_HPP_
+
+#include <memory>
+
+namespace signals
+{
+
+// Object whose lifetime a connection is tied to
+struct Tracked
+{
+    std::weak_ptr<const void> object;
+};
+
+template<typename T>
+Tracked track(const std::shared_ptr<T>& object) noexcept
+{
+    return Tracked{object};
+}
+
+} // namespace signals
+
+#endif
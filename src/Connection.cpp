@@ -1,6 +1,7 @@
 // Copyright (c) 2020 Antero Nousiainen
 
 #include "signals/Connection.hpp"
+#include <functional>
 
 namespace signals
 {
@@ -10,6 +11,11 @@ Connection::Connection(const Disconnectable& slot) noexcept :
 {
 }
 
+Connection::Connection(SlotBase& slot) noexcept :
+    slot(Handle{SlotBase::Reference{slot}, slot.generation()})
+{
+}
+
 Connection& Connection::operator=(Connection&& other) noexcept
 {
     if (this == &other)
@@ -21,14 +27,63 @@ Connection& Connection::operator=(Connection&& other) noexcept
 
 bool Connection::connected() const
 {
-    const auto s = slot.lock();
-    return s && s->connected();
+    auto connected = false;
+    visit([&connected](signals::Disconnectable& s) {
+        connected = s.connected();
+    });
+    return connected;
 }
 
 void Connection::disconnect()
 {
-    if (auto s = slot.lock(); s)
-        s->disconnect();
+    visit(std::mem_fn(&signals::Disconnectable::disconnect));
+}
+
+void Connection::block()
+{
+    visit(std::mem_fn(&signals::Disconnectable::block));
+}
+
+void Connection::unblock()
+{
+    visit(std::mem_fn(&signals::Disconnectable::unblock));
+}
+
+bool Connection::blocked() const
+{
+    auto blocked = false;
+    visit([&blocked](signals::Disconnectable& s) {
+        blocked = s.blocked();
+    });
+    return blocked;
+}
+
+// Call `fn` with the slot if it still exists and has not been recycled
+template<typename Fn>
+void Connection::visit(Fn&& fn) const
+{
+    if (const auto handle = std::get_if<Handle>(&slot); handle)
+    {
+        if (const auto s = handle->lock(); s)
+            std::invoke(std::forward<Fn>(fn), *s);
+
+        return;
+    }
+
+    if (const auto s = std::get<Disconnectable::weak_type>(slot).lock(); s)
+        std::invoke(std::forward<Fn>(fn), *s);
+}
+
+SlotBase* Connection::intrusiveSlot() const noexcept
+{
+    const auto handle = std::get_if<Handle>(&slot);
+    return handle ? handle->lock() : nullptr;
+}
+
+SlotBase* Connection::Handle::lock() const noexcept
+{
+    const auto s = slot.get();
+    return s && s->generation() == generation ? s : nullptr;
 }
 
 } // namespace signals
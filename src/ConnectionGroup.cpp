@@ -0,0 +1,113 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/ConnectionGroup.hpp"
+#include "signals/IntrusivePtr.hpp"
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <utility>
+
+namespace signals
+{
+
+ConnectionGroup::~ConnectionGroup()
+{
+    disconnect();
+}
+
+ConnectionGroup& ConnectionGroup::operator=(ConnectionGroup&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    disconnect();
+    connections = std::move(other.connections);
+    return *this;
+}
+
+void ConnectionGroup::add(Connection connection)
+{
+    connections.push_back(std::move(connection));
+}
+
+void ConnectionGroup::add(ScopedConnection&& connection)
+{
+    add(connection.release());
+}
+
+std::size_t ConnectionGroup::size() const noexcept
+{
+    return connections.size();
+}
+
+bool ConnectionGroup::empty() const noexcept
+{
+    return connections.empty();
+}
+
+void ConnectionGroup::disconnect()
+{
+    // The signals of the slots in the order they were first seen, and the slots by the index
+    // of their signal. The slots are kept alive while they are disconnected.
+    auto signals = std::vector<SlotBase::Owner*>{};
+    auto owned = std::vector<std::pair<std::size_t, IntrusivePtr<SlotBase>>>{};
+    owned.reserve(connections.size());
+
+    for (auto& connection : connections)
+    {
+        const auto slot = connection.intrusiveSlot();
+
+        if (!slot || !slot->owner())
+        {
+            connection.disconnect();
+            continue;
+        }
+
+        // Connections to the same signal are usually added one after another
+        if (signals.empty() || signals[owned.back().first] != slot->owner())
+        {
+            const auto signal = std::ranges::find(signals, slot->owner());
+            owned.emplace_back(signal - signals.begin(), slot);
+
+            if (signal == signals.end())
+                signals.push_back(slot->owner());
+        }
+        else
+            owned.emplace_back(owned.back().first, slot);
+    }
+
+    connections.clear();
+
+    // Put the slots of each signal together, keeping their order
+    auto ends = std::vector<std::size_t>(signals.size() + 1);
+
+    for (const auto& [signal, slot] : owned)
+        ++ends[signal + 1];
+
+    std::partial_sum(ends.begin(), ends.end(), ends.begin());
+
+    auto slots = std::vector<SlotBase*>(owned.size());
+
+    for (const auto& [signal, slot] : owned)
+        slots[ends[signal]++] = slot.get();
+
+    // Disconnecting may destroy or move the other signals, so the signal of the slots is
+    // looked up again. The slots of a destroyed signal were disconnected with it.
+    for (auto first = std::size_t{0}; const auto last : ends)
+    {
+        if (first == last)
+            continue;
+
+        if (const auto signal = slots[first]->owner(); signal)
+            signal->disconnect(std::span{slots}.subspan(first, last - first));
+
+        first = last;
+    }
+}
+
+std::vector<Connection> ConnectionGroup::release() noexcept
+{
+    return std::exchange(connections, {});
+}
+
+} // namespace signals
@@ -0,0 +1,109 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/EventLoop.hpp"
+#include <map>
+#include <mutex>
+
+namespace signals
+{
+namespace
+{
+
+struct Registry
+{
+    std::mutex mutex;
+    std::map<std::string, EventLoop*, std::less<>> loops;
+};
+
+Registry& registry()
+{
+    static auto instance = Registry{};
+    return instance;
+}
+
+} // namespace
+
+EventLoop::EventLoop(std::string name) :
+    loopName(std::move(name))
+{
+    auto& r = registry();
+    const auto lock = std::scoped_lock{r.mutex};
+    r.loops.insert_or_assign(loopName, this);
+}
+
+EventLoop::~EventLoop()
+{
+    if (loopName.empty())
+        return;
+
+    auto& r = registry();
+    const auto lock = std::scoped_lock{r.mutex};
+
+    if (const auto it = r.loops.find(loopName); it != r.loops.end() && it->second == this)
+        r.loops.erase(it);
+}
+
+EventLoop* EventLoop::find(std::string_view name)
+{
+    auto& r = registry();
+    const auto lock = std::scoped_lock{r.mutex};
+    const auto it = r.loops.find(name);
+    return it != r.loops.end() ? it->second : nullptr;
+}
+
+const std::string& EventLoop::name() const noexcept
+{
+    return loopName;
+}
+
+void EventLoop::post(Task task)
+{
+    tasks.push(std::move(task));
+    queued.fetch_add(1);
+    posted.fetch_add(1);
+    posted.notify_one();
+}
+
+void EventLoop::run()
+{
+    while (!stopped.load())
+    {
+        // Tasks posted after reading the counter wake up the wait
+        const auto seen = posted.load();
+
+        if (poll() == 0)
+            posted.wait(seen);
+    }
+
+    stopped.store(false);
+}
+
+std::size_t EventLoop::poll()
+{
+    // Tasks posted by the tasks are left for the next poll, so that a task posting itself
+    // again does not keep the loop from returning
+    const auto pending = queued.load();
+    auto count = std::size_t{0};
+
+    for (; count < pending; ++count)
+    {
+        auto task = tasks.pop();
+
+        if (!task)
+            break;
+
+        std::invoke(*task);
+    }
+
+    queued.fetch_sub(count);
+    return count;
+}
+
+void EventLoop::stop()
+{
+    stopped.store(true);
+    posted.fetch_add(1);
+    posted.notify_all();
+}
+
+} // namespace signals
@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/Instrumentation.hpp"
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace signals
+{
+namespace
+{
+
+struct Registry
+{
+    std::mutex mutex;
+    std::map<const EmissionMetrics*, std::string> metrics;
+};
+
+Registry& registry()
+{
+    static auto instance = Registry{};
+    return instance;
+}
+
+} // namespace
+
+double EmissionMetrics::Snapshot::deadSlotRatio() const noexcept
+{
+    const auto reached = invocations + skipped;
+    return reached != 0 ? static_cast<double>(skipped) / static_cast<double>(reached) : 0.0;
+}
+
+EmissionMetrics::~EmissionMetrics()
+{
+    if (published)
+        MetricsRegistry::remove(*this);
+}
+
+void EmissionMetrics::publish(std::string name)
+{
+    MetricsRegistry::add(std::move(name), *this);
+    published = true;
+}
+
+auto EmissionMetrics::snapshot() const noexcept -> Snapshot
+{
+    auto snapshot = Snapshot{};
+
+    for (const auto& shard : counters)
+    {
+        snapshot.emissions += shard.emissions.load(std::memory_order_relaxed);
+        snapshot.invocations += shard.invocations.load(std::memory_order_relaxed);
+        snapshot.skipped += shard.skipped.load(std::memory_order_relaxed);
+
+        for (auto i = std::size_t{0}; i < latencyBuckets; ++i)
+            snapshot.latency[i] += shard.latency[i].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+auto MetricsRegistry::snapshot() -> std::vector<Entry>
+{
+    auto entries = std::vector<Entry>{};
+
+    {
+        auto& r = registry();
+        const auto lock = std::scoped_lock{r.mutex};
+        entries.reserve(r.metrics.size());
+
+        for (const auto& [metrics, name] : r.metrics)
+            entries.emplace_back(name, metrics->snapshot());
+    }
+
+    std::ranges::sort(entries, {}, &Entry::first);
+    return entries;
+}
+
+void MetricsRegistry::add(std::string name, const EmissionMetrics& metrics)
+{
+    auto& r = registry();
+    const auto lock = std::scoped_lock{r.mutex};
+    r.metrics.insert_or_assign(&metrics, std::move(name));
+}
+
+void MetricsRegistry::remove(const EmissionMetrics& metrics)
+{
+    auto& r = registry();
+    const auto lock = std::scoped_lock{r.mutex};
+    r.metrics.erase(&metrics);
+}
+
+} // namespace signals
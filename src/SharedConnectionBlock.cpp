@@ -0,0 +1,85 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/SharedConnectionBlock.hpp"
+#include <utility>
+
+namespace signals
+{
+
+SharedConnectionBlock::SharedConnectionBlock(const Connection& connection, bool blocking) :
+    blocked(connection)
+{
+    if (blocking)
+        block();
+}
+
+SharedConnectionBlock::SharedConnectionBlock(const SharedConnectionBlock& other) :
+    SharedConnectionBlock(other.blocked, other.isBlocking)
+{
+}
+
+SharedConnectionBlock::SharedConnectionBlock(SharedConnectionBlock&& other) noexcept :
+    blocked(std::move(other.blocked)),
+    isBlocking(std::exchange(other.isBlocking, false))
+{
+}
+
+SharedConnectionBlock::~SharedConnectionBlock()
+{
+    unblock();
+}
+
+SharedConnectionBlock& SharedConnectionBlock::operator=(const SharedConnectionBlock& other)
+{
+    if (this == &other)
+        return *this;
+
+    unblock();
+    blocked = other.blocked;
+
+    if (other.isBlocking)
+        block();
+
+    return *this;
+}
+
+SharedConnectionBlock& SharedConnectionBlock::operator=(SharedConnectionBlock&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    unblock();
+    blocked = std::move(other.blocked);
+    isBlocking = std::exchange(other.isBlocking, false);
+    return *this;
+}
+
+void SharedConnectionBlock::block()
+{
+    if (isBlocking)
+        return;
+
+    blocked.block();
+    isBlocking = true;
+}
+
+void SharedConnectionBlock::unblock()
+{
+    if (!isBlocking)
+        return;
+
+    blocked.unblock();
+    isBlocking = false;
+}
+
+bool SharedConnectionBlock::blocking() const noexcept
+{
+    return isBlocking;
+}
+
+Connection SharedConnectionBlock::connection() const
+{
+    return blocked;
+}
+
+} // namespace signals
@@ -0,0 +1,127 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/SlotBase.hpp"
+#include <utility>
+
+namespace signals
+{
+
+SlotBase::~SlotBase()
+{
+    while (referrers)
+        referrers->unlink();
+}
+
+SlotBase::Generation SlotBase::generation() const noexcept
+{
+    return current;
+}
+
+void SlotBase::retain() noexcept
+{
+    ++references;
+}
+
+void SlotBase::release() noexcept
+{
+    if (--references == 0)
+        destroy();
+}
+
+SlotBase::Owner* SlotBase::owner() const noexcept
+{
+    return owning;
+}
+
+void SlotBase::recycle() noexcept
+{
+    ++current;
+}
+
+void SlotBase::own(Owner* owner) noexcept
+{
+    owning = owner;
+}
+
+void SlotBase::destroy() noexcept
+{
+    delete this;
+}
+
+SlotBase::Reference::Reference(SlotBase& slot) noexcept
+{
+    link(&slot);
+}
+
+SlotBase::Reference::Reference(const Reference& other) noexcept
+{
+    link(other.slot);
+}
+
+SlotBase::Reference::Reference(Reference&& other) noexcept
+{
+    link(other.slot);
+    other.unlink();
+}
+
+SlotBase::Reference::~Reference()
+{
+    unlink();
+}
+
+SlotBase::Reference& SlotBase::Reference::operator=(const Reference& other) noexcept
+{
+    if (this != &other)
+    {
+        unlink();
+        link(other.slot);
+    }
+
+    return *this;
+}
+
+SlotBase::Reference& SlotBase::Reference::operator=(Reference&& other) noexcept
+{
+    if (this != &other)
+    {
+        unlink();
+        link(other.slot);
+        other.unlink();
+    }
+
+    return *this;
+}
+
+SlotBase* SlotBase::Reference::get() const noexcept
+{
+    return slot;
+}
+
+void SlotBase::Reference::link(SlotBase* slot) noexcept
+{
+    if (!slot)
+        return;
+
+    this->slot = slot;
+    after = std::exchange(slot->referrers, this);
+
+    if (after)
+        after->before = this;
+}
+
+void SlotBase::Reference::unlink() noexcept
+{
+    if (!slot)
+        return;
+
+    (before ? before->after : slot->referrers) = after;
+
+    if (after)
+        after->before = before;
+
+    slot = nullptr;
+    before = nullptr;
+    after = nullptr;
+}
+
+} // namespace signals
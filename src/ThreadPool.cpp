@@ -0,0 +1,149 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "signals/ThreadPool.hpp"
+#include <algorithm>
+#include <optional>
+
+namespace signals
+{
+namespace
+{
+
+// The pool and the queue of the worker running on this thread
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentQueue = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool() :
+    ThreadPool(std::max(std::thread::hardware_concurrency(), 1u))
+{
+}
+
+ThreadPool::ThreadPool(std::size_t threads)
+{
+    threads = std::max(threads, std::size_t{1});
+    queues.reserve(threads);
+    workers.reserve(threads);
+
+    for (auto i = std::size_t{0}; i < threads; ++i)
+        queues.push_back(std::make_unique<Queue>());
+
+    for (auto i = std::size_t{0}; i < threads; ++i)
+        workers.emplace_back([this, i](std::stop_token stop) { work(stop, i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    for (auto& worker : workers)
+        worker.request_stop();
+
+    workers.clear();
+}
+
+ThreadPool& ThreadPool::shared()
+{
+    static auto pool = ThreadPool{};
+    return pool;
+}
+
+std::size_t ThreadPool::size() const noexcept
+{
+    return workers.size();
+}
+
+void ThreadPool::post(Task task)
+{
+    auto& queue = *queues[current()];
+
+    // Counting the task first may make a worker look for it before it is queued,
+    // but never lets the count drop below the number of queued tasks
+    pending.fetch_add(1);
+
+    {
+        const auto lock = std::scoped_lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // A worker going to sleep registers itself before checking for pending tasks,
+    // so either it sees this task or this sees it sleeping
+    if (sleeping.load() > 0)
+    {
+        {
+            const auto lock = std::scoped_lock{mutex};
+        }
+
+        available.notify_one();
+    }
+}
+
+bool ThreadPool::tryRun()
+{
+    return tryRun(current());
+}
+
+std::size_t ThreadPool::current() noexcept
+{
+    if (currentPool == this)
+        return currentQueue;
+
+    return next.fetch_add(1, std::memory_order_relaxed) % queues.size();
+}
+
+bool ThreadPool::tryRun(std::size_t queue)
+{
+    auto task = std::optional<Task>{};
+
+    // The own queue is used as a stack to keep the recently posted tasks warm in the cache,
+    // other queues are stolen from the other end to take the oldest and likely largest tasks
+    for (auto i = std::size_t{0}; i < queues.size() && !task; ++i)
+    {
+        auto& q = *queues[(queue + i) % queues.size()];
+        const auto lock = std::scoped_lock{q.mutex};
+
+        if (q.tasks.empty())
+            continue;
+
+        if (i == 0)
+        {
+            task.emplace(std::move(q.tasks.back()));
+            q.tasks.pop_back();
+        }
+        else
+        {
+            task.emplace(std::move(q.tasks.front()));
+            q.tasks.pop_front();
+        }
+    }
+
+    if (!task)
+        return false;
+
+    pending.fetch_sub(1);
+    std::invoke(*task);
+    return true;
+}
+
+void ThreadPool::work(std::stop_token stop, std::size_t queue)
+{
+    currentPool = this;
+    currentQueue = queue;
+
+    for (;;)
+    {
+        if (tryRun(queue))
+            continue;
+
+        auto lock = std::unique_lock{mutex};
+        sleeping.fetch_add(1);
+        available.wait(lock, stop, [this] { return pending.load() > 0; });
+        sleeping.fetch_sub(1);
+
+        // Stop only once the pending tasks have been run, a task taken by another thread
+        // before this one woke up is no reason to stop
+        if (stop.stop_requested() && pending.load() == 0)
+            return;
+    }
+}
+
+} // namespace signals
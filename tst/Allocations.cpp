@@ -0,0 +1,38 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Allocations.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> allocated = 0;
+} // namespace
+
+std::size_t signals::test::bytesAllocated() noexcept
+{
+    return allocated.load(std::memory_order_relaxed);
+}
+
+// Overridden operator new to spy on how many bytes are allocated
+void* operator new(std::size_t count)
+{
+    allocated.fetch_add(count, std::memory_order_relaxed);
+
+    if (auto p = std::malloc(count); p)
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+// Memory from the overridden operator new is released with free
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,16 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_TST_ALLOCATIONS_HPP_
+#define SIGNALS_TST_ALLOCATIONS_HPP_
+
+#include <cstddef>
+
+namespace signals::test
+{
+
+// Number of bytes allocated with the global operator new so far
+std::size_t bytesAllocated() noexcept;
+
+} // namespace signals::test
+
+#endif
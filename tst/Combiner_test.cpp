@@ -0,0 +1,122 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Allocations.hpp"
+#include <signals/Combiner.hpp>
+#include <signals/Signal.hpp>
+#include <gmock/gmock.h>
+#include <array>
+#include <optional>
+#include <string>
+
+namespace
+{
+using namespace testing;
+
+class CombinerTest : public Test
+{
+protected:
+    template<typename Signal, typename... Rs>
+    void connectReturning(Signal& signal, Rs... rs)
+    {
+        (signal.connect([this, rs] {
+            ++invoked;
+            return rs;
+        }),
+         ...);
+    }
+
+    int invoked = 0;
+};
+
+std::array<int, 2> buffer;
+
+struct TestBuffer
+{
+    std::span<int> operator()() const
+    {
+        return buffer;
+    }
+};
+
+TEST_F(CombinerTest, AnyOfStopsAtFirstTrue)
+{
+    auto any = signals::Signal<bool(), signals::AnyOf>{};
+    EXPECT_FALSE(any());
+
+    connectReturning(any, false, true, true);
+    EXPECT_TRUE(any());
+    EXPECT_EQ(2, invoked);
+}
+
+TEST_F(CombinerTest, AllOfStopsAtFirstFalse)
+{
+    auto all = signals::Signal<bool(), signals::AllOf>{};
+    EXPECT_TRUE(all());
+
+    connectReturning(all, true, false, true);
+    EXPECT_FALSE(all());
+    EXPECT_EQ(2, invoked);
+}
+
+TEST_F(CombinerTest, FirstNonEmptyStopsAtFirstResultWithValue)
+{
+    using Result = std::optional<std::string>;
+    auto first = signals::Signal<Result(), signals::FirstNonEmpty<Result>>{};
+    EXPECT_EQ(std::nullopt, first());
+
+    connectReturning(first, Result{}, Result{"first"}, Result{"second"});
+    EXPECT_EQ("first", first());
+    EXPECT_EQ(2, invoked);
+}
+
+TEST_F(CombinerTest, AccumulateAllResults)
+{
+    auto product = signals::Signal<int(), signals::Accumulate<int, std::multiplies<>>>{};
+    auto sum = signals::Signal<int(), signals::Accumulate<int>>{};
+
+    connectReturning(product, 2, 3);
+    connectReturning(sum, 2, 3);
+    EXPECT_EQ(0, product());
+    EXPECT_EQ(5, sum());
+}
+
+TEST_F(CombinerTest, CollectIntoBufferUntilItIsFull)
+{
+    auto collect = signals::Signal<int(), signals::CollectInto<int, TestBuffer>>{};
+    EXPECT_TRUE(collect().empty());
+
+    connectReturning(collect, 1, 2, 3);
+    EXPECT_THAT(collect(), ElementsAre(1, 2));
+    EXPECT_EQ(2, invoked);
+    EXPECT_THAT(buffer, ElementsAre(1, 2));
+}
+
+TEST_F(CombinerTest, MaxElementReturnsFirstGreatestResult)
+{
+    using Result = std::pair<int, int>;
+    using Compare = decltype([](const Result& a, const Result& b) {
+        return a.first < b.first;
+    });
+    auto max = signals::Signal<Result(), signals::MaxElement<Result, Compare>>{};
+    EXPECT_EQ(std::nullopt, max());
+
+    connectReturning(max, Result{1, 1}, Result{3, 2}, Result{2, 3}, Result{3, 4});
+    EXPECT_EQ((Result{3, 2}), max());
+}
+
+TEST_F(CombinerTest, DoNotAllocateOnSignal)
+{
+    auto any = signals::Signal<bool(), signals::AnyOf>{};
+    auto collect = signals::Signal<int(), signals::CollectInto<int, TestBuffer>>{};
+    auto max = signals::Signal<int(), signals::MaxElement<int>>{};
+    connectReturning(any, false, true);
+    connectReturning(collect, 1, 2, 3);
+    connectReturning(max, 1, 2, 3);
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    any();
+    collect();
+    max();
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+}
+} // namespace
@@ -0,0 +1,63 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentEvent.hpp>
+#include <signals/ScopedConnection.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+struct TestEvent : signals::ConcurrentEvent<TestEvent, bool(int)>
+{
+};
+
+struct CountEvent : signals::ConcurrentEvent<CountEvent, void()>
+{
+};
+
+class ConcurrentEventTest : public Test
+{
+protected:
+    TestEvent event;
+};
+
+TEST_F(ConcurrentEventTest, InvokeSubscriberOnEvent)
+{
+    signals::ScopedConnection scopedSubscription = TestEvent::subscribe([](int answer) {
+        return (answer == 42);
+    });
+
+    EXPECT_TRUE(event(42));
+    EXPECT_FALSE(event(13));
+}
+
+TEST_F(ConcurrentEventTest, FireAndSubscribeFromManyThreads)
+{
+    constexpr auto iterations = 2000;
+    auto fired = std::atomic<int>{0};
+    auto threads = std::vector<std::jthread>{};
+
+    const auto persistent = signals::ScopedConnection{CountEvent::subscribe([&fired] {
+        fired.fetch_add(1, std::memory_order_relaxed);
+    })};
+
+    for (auto i = 0; i < 4; ++i)
+        threads.emplace_back([] {
+            for (auto n = 0; n < iterations; ++n)
+                CountEvent{}();
+        });
+
+    threads.emplace_back([] {
+        for (auto n = 0; n < iterations / 10; ++n)
+            const auto scoped = signals::ScopedConnection{CountEvent::subscribe([] {})};
+    });
+
+    threads.clear();
+
+    EXPECT_EQ(4 * iterations, fired.load());
+}
+} // namespace
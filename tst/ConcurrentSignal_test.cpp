@@ -0,0 +1,176 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentSignal.hpp>
+#include <signals/ScopedConnection.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace testing;
+
+class ConcurrentSignalTest : public Test
+{
+protected:
+    using Signal = signals::ConcurrentSignal<void(int&)>;
+
+    Signal signal;
+};
+
+// LCOV_EXCL_START
+void noop(int&)
+{
+}
+// LCOV_EXCL_STOP
+
+auto add(int i)
+{
+    return [i](int& n) {
+        n += i;
+    };
+}
+
+TEST_F(ConcurrentSignalTest, IsNoncopyableAndNonmoveable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<Signal>);
+    EXPECT_FALSE(std::is_move_constructible_v<Signal>);
+}
+
+TEST_F(ConcurrentSignalTest, IsEmptyByDefault)
+{
+    EXPECT_TRUE(signal.empty());
+    EXPECT_EQ(0, signal.num_slots());
+}
+
+TEST_F(ConcurrentSignalTest, IsEmptyWhenSlotsAreDisconnected)
+{
+    auto connection = signal.connect(noop);
+    signal.connect(noop);
+    EXPECT_EQ(2, signal.num_slots());
+
+    connection.disconnect();
+    EXPECT_EQ(1, signal.num_slots());
+
+    signal.clear();
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(ConcurrentSignalTest, InvokeConnectedSlotsOnSignal)
+{
+    auto result = 0;
+    signal.connect(add(1));
+    auto connection = signal.connect(add(2));
+    signal.connect(add(3));
+
+    connection.disconnect();
+    signal(result);
+
+    EXPECT_EQ(4, result);
+}
+
+TEST_F(ConcurrentSignalTest, MoveArgumentsToLastSlotWhenEmittingMoving)
+{
+    auto pointers = signals::ConcurrentSignal<void(std::shared_ptr<int>)>{};
+    auto first = 0;
+    auto lastUses = 0L;
+    pointers.connect([&first](const std::shared_ptr<int>& p) { first = *p; });
+    pointers.connect([&lastUses](std::shared_ptr<int> p) { lastUses = p.use_count(); });
+
+    pointers.emit_moving(std::make_shared<int>(42));
+
+    EXPECT_EQ(42, first);
+    EXPECT_EQ(1, lastUses);
+}
+
+TEST_F(ConcurrentSignalTest, DoNotInvokeSlotConnectedDuringSignal)
+{
+    auto result = 0;
+    signal.connect([this](int& n) {
+        signal.connect(add(10));
+        n += 1;
+    });
+
+    signal(result);
+    EXPECT_EQ(1, result);
+
+    signal(result);
+    EXPECT_EQ(12, result);
+}
+
+TEST_F(ConcurrentSignalTest, SupportDisconnectingDuringSignal)
+{
+    auto result = 0;
+    auto connection = signals::Connection{};
+
+    signal.connect([&connection](int& n) {
+        connection.disconnect();
+        n += 1;
+    });
+    connection = signal.connect(add(2));
+
+    signal(result);
+    EXPECT_EQ(1, result);
+}
+
+TEST_F(ConcurrentSignalTest, DoNotInvokeBlockedSlotsUntilUnblocked)
+{
+    auto result = 0;
+    auto connection = signal.connect(add(2));
+
+    connection.block();
+    signal(result);
+    EXPECT_EQ(0, result);
+    EXPECT_FALSE(signal.empty());
+
+    connection.unblock();
+    signal(result);
+    EXPECT_EQ(2, result);
+}
+
+TEST_F(ConcurrentSignalTest, ReturnLastValueWhenDefaultCombinerIsUsed)
+{
+    auto last = signals::ConcurrentSignal<int()>{};
+
+    // clang-format off
+    last.connect([]{ return 1; });
+    last.connect([]{ return 2; });
+    // clang-format on
+
+    EXPECT_EQ(2, last());
+}
+
+TEST_F(ConcurrentSignalTest, SupportConcurrentEmitConnectAndDisconnect)
+{
+    constexpr auto iterations = 2000;
+    auto emitted = std::atomic<int>{0};
+    auto threads = std::vector<std::jthread>{};
+
+    const auto persistent = signals::ScopedConnection{signal.connect([&emitted](int&) {
+        emitted.fetch_add(1, std::memory_order_relaxed);
+    })};
+
+    for (auto i = 0; i < 3; ++i)
+        threads.emplace_back([this] {
+            for (auto n = 0; n < iterations; ++n)
+            {
+                auto result = 0;
+                signal(result);
+            }
+        });
+
+    for (auto i = 0; i < 2; ++i)
+        threads.emplace_back([this] {
+            for (auto n = 0; n < iterations / 10; ++n)
+            {
+                const auto scoped = signals::ScopedConnection{signal.connect(add(n))};
+                EXPECT_LE(2, signal.num_slots());
+            }
+        });
+
+    threads.clear();
+
+    EXPECT_EQ(3 * iterations, emitted.load());
+    EXPECT_EQ(1, signal.num_slots());
+}
+} // namespace
@@ -0,0 +1,77 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentSlot.hpp>
+#include <signals/Connection.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace testing;
+
+class ConcurrentSlotTest : public Test
+{
+protected:
+    using Disconnectable = signals::Disconnectable;
+    using Slot = signals::ConcurrentSlot<int()>;
+};
+
+TEST_F(ConcurrentSlotTest, IsDisconnectable)
+{
+    EXPECT_TRUE((std::is_base_of_v<Disconnectable, Slot>));
+}
+
+TEST_F(ConcurrentSlotTest, IsNoncopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<Slot>);
+    EXPECT_FALSE(std::is_copy_assignable_v<Slot>);
+}
+
+TEST_F(ConcurrentSlotTest, IsNonmoveable)
+{
+    EXPECT_FALSE(std::is_move_constructible_v<Slot>);
+    EXPECT_FALSE(std::is_move_assignable_v<Slot>);
+}
+
+TEST_F(ConcurrentSlotTest, IsNotConnectedWithoutCallable)
+{
+    EXPECT_FALSE(Slot{nullptr}.connected());
+}
+
+TEST_F(ConcurrentSlotTest, KeepCallableWhenDisconnected)
+{
+    const auto slot = std::make_shared<Slot>([] {
+        return 42;
+    });
+
+    signals::Connection{slot}.disconnect();
+
+    EXPECT_FALSE(slot->connected());
+    EXPECT_EQ(42, std::invoke(*slot));
+}
+
+TEST_F(ConcurrentSlotTest, CancelCallableOnceWhenDisconnected)
+{
+    struct Cancellable
+    {
+        int operator()() const
+        {
+            return 42;
+        }
+
+        void cancel() const
+        {
+            ++*cancels;
+        }
+
+        int* cancels;
+    };
+
+    auto cancels = 0;
+    const auto slot = std::make_shared<Slot>(Cancellable{&cancels});
+    EXPECT_EQ(0, cancels);
+
+    signals::Connection{slot}.disconnect();
+    signals::Connection{slot}.disconnect();
+    EXPECT_EQ(1, cancels);
+}
+} // namespace
@@ -0,0 +1,157 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentSignal.hpp>
+#include <signals/ConnectionGroup.hpp>
+#include <signals/ScopedConnection.hpp>
+#include <signals/Signal.hpp>
+#include <gmock/gmock.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class ConnectionGroupTest : public Test
+{
+protected:
+    signals::Signal<void()> signal;
+    signals::ConnectionGroup group;
+};
+
+TEST_F(ConnectionGroupTest, IsEmptyByDefault)
+{
+    EXPECT_TRUE(group.empty());
+    EXPECT_THAT(group.size(), Eq(0));
+}
+
+TEST_F(ConnectionGroupTest, DisconnectsAllConnectionsWhenDestroyed)
+{
+    auto concurrent = signals::ConcurrentSignal<void()>{};
+
+    {
+        auto scoped = signals::ConnectionGroup{};
+        scoped.add(signal.connect([] {}));
+        scoped.add(signal.connect([] {}));
+        scoped.add(concurrent.connect([] {}));
+
+        EXPECT_THAT(scoped.size(), Eq(3));
+    }
+
+    EXPECT_TRUE(signal.empty());
+    EXPECT_TRUE(concurrent.empty());
+}
+
+TEST_F(ConnectionGroupTest, DisconnectRemovesTheConnections)
+{
+    const auto connection = signal.connect([] {});
+    group.add(connection);
+
+    group.disconnect();
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(group.empty());
+}
+
+TEST_F(ConnectionGroupTest, TakesOverScopedConnection)
+{
+    {
+        auto scoped = signals::ScopedConnection{signal.connect([] {})};
+        group.add(std::move(scoped));
+    }
+
+    EXPECT_THAT(signal.num_slots(), Eq(1));
+
+    group.disconnect();
+
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(ConnectionGroupTest, DisconnectsSlotsOfEachSignalTogether)
+{
+    auto other = signals::Signal<void()>{};
+    auto invoked = std::vector<int>{};
+    signal.connect([&invoked] { invoked.push_back(1); });
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        group.add(signal.connect([] {}));
+        group.add(other.connect([] {}));
+    }
+
+    signal.connect([&invoked] { invoked.push_back(2); });
+    group.disconnect();
+    signal();
+
+    EXPECT_THAT(signal.num_slots(), Eq(2));
+    EXPECT_TRUE(other.empty());
+    EXPECT_THAT(invoked, ElementsAre(1, 2));
+}
+
+TEST_F(ConnectionGroupTest, DisconnectsWhileSignalIsEmitting)
+{
+    auto invoked = 0;
+    signal.connect([this] { group.disconnect(); });
+    group.add(signal.connect([&invoked] { ++invoked; }));
+
+    signal();
+    signal();
+
+    EXPECT_THAT(invoked, Eq(0));
+    EXPECT_THAT(signal.num_slots(), Eq(1));
+}
+
+TEST_F(ConnectionGroupTest, DisconnectsWhenDisconnectingDestroysAnotherSignal)
+{
+    auto other = std::make_unique<signals::Signal<void()>>();
+    group.add(signal.connect([destroyOther = std::shared_ptr<void>{nullptr, [&other](void*) {
+        other.reset();
+    }}] {}));
+    group.add(other->connect([] {}));
+
+    group.disconnect();
+
+    EXPECT_TRUE(signal.empty());
+    EXPECT_THAT(other, IsNull());
+}
+
+TEST_F(ConnectionGroupTest, IgnoresConnectionsDisconnectedElsewhere)
+{
+    auto connection = signal.connect([] {});
+    group.add(connection);
+    connection.disconnect();
+    signal.connect([] {});
+
+    group.disconnect();
+
+    EXPECT_THAT(signal.num_slots(), Eq(1));
+}
+
+TEST_F(ConnectionGroupTest, ReleaseKeepsTheConnectionsConnected)
+{
+    group.add(signal.connect([] {}));
+
+    const auto connections = group.release();
+
+    EXPECT_TRUE(group.empty());
+    ASSERT_THAT(connections, SizeIs(1));
+    EXPECT_TRUE(connections.front().connected());
+}
+
+TEST_F(ConnectionGroupTest, MoveAssignmentDisconnectsThePreviousConnections)
+{
+    const auto previous = signal.connect([] {});
+    group.add(previous);
+
+    auto other = signals::ConnectionGroup{};
+    const auto next = signal.connect([] {});
+    other.add(next);
+    group = std::move(other);
+
+    EXPECT_FALSE(previous.connected());
+    EXPECT_TRUE(next.connected());
+    EXPECT_THAT(group.size(), Eq(1));
+}
+
+} // namespace
@@ -1,6 +1,7 @@
 // Copyright (c) 2020 Antero Nousiainen
 
 #include <signals/Connection.hpp>
+#include <signals/IntrusivePtr.hpp>
 #include <gtest/gtest.h>
 
 namespace signals
@@ -22,14 +23,70 @@ public:
         isConnected = false;
     }
 
+    [[nodiscard]] bool blocked() const override
+    {
+        return blocks != 0;
+    }
+
+    void block() override
+    {
+        ++blocks;
+    }
+
+    void unblock() override
+    {
+        --blocks;
+    }
+
+private:
+    bool isConnected = true;
+    int blocks = 0;
+};
+
+class RecyclableSlot : public SlotBase
+{
+public:
+    [[nodiscard]] bool connected() const override
+    {
+        return isConnected;
+    }
+
+    void disconnect() override
+    {
+        isConnected = false;
+    }
+
+    [[nodiscard]] bool blocked() const override
+    {
+        return blocks != 0;
+    }
+
+    void block() override
+    {
+        ++blocks;
+    }
+
+    void unblock() override
+    {
+        --blocks;
+    }
+
+    void reconnect()
+    {
+        recycle();
+        isConnected = true;
+    }
+
 private:
     bool isConnected = true;
+    int blocks = 0;
 };
 
 class ConnectionTest : public Test
 {
 protected:
     Connection::Disconnectable slot = std::make_shared<Slot>();
+    IntrusivePtr<RecyclableSlot> recyclable{new RecyclableSlot};
 };
 
 TEST_F(ConnectionTest, IsNothrowDefaultConstructible)
@@ -156,6 +213,73 @@ TEST_F(ConnectionTest, DoNotDisconnectTargetSlotIsWhenMoveAssigned)
     EXPECT_TRUE(slot->connected());
 }
 
+TEST_F(ConnectionTest, DisconnectRecyclableSlotWhenDisconnected)
+{
+    auto connection = Connection{*recyclable};
+    EXPECT_TRUE(connection.connected());
+
+    connection.disconnect();
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_FALSE(recyclable->connected());
+}
+
+TEST_F(ConnectionTest, IsDisconnectedWhenRecyclableSlotIsRecycled)
+{
+    auto connection = Connection{*recyclable};
+
+    recyclable->disconnect();
+    recyclable->reconnect();
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(recyclable->connected());
+}
+
+TEST_F(ConnectionTest, DoNotDisconnectRecycledSlot)
+{
+    auto connection = Connection{*recyclable};
+    recyclable->reconnect();
+
+    connection.disconnect();
+
+    EXPECT_TRUE(recyclable->connected());
+}
+
+TEST_F(ConnectionTest, IsDisconnectedWhenRecyclableSlotIsDestroyed)
+{
+    auto connection = Connection{*recyclable};
+    const auto copy = connection;
+    recyclable.reset();
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_FALSE(copy.connected());
+
+    connection.disconnect();
+}
+
+TEST_F(ConnectionTest, BlockSlotUntilUnblocked)
+{
+    auto connection = Connection{slot};
+
+    connection.block();
+    EXPECT_TRUE(connection.blocked());
+    EXPECT_TRUE(connection.connected());
+
+    connection.unblock();
+    EXPECT_FALSE(connection.blocked());
+}
+
+TEST_F(ConnectionTest, DoNotBlockRecycledSlot)
+{
+    auto connection = Connection{*recyclable};
+    recyclable->reconnect();
+
+    connection.block();
+
+    EXPECT_FALSE(connection.blocked());
+    EXPECT_FALSE(recyclable->blocked());
+}
+
 TEST_F(ConnectionTest, IsSelfMoveSafe)
 {
     auto connection = Connection{slot};
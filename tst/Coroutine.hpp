@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_TST_COROUTINE_HPP_
+#define SIGNALS_TST_COROUTINE_HPP_
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace signals::test
+{
+
+// Coroutine that runs until it first suspends when called and is destroyed with its handle
+class Coroutine
+{
+public:
+    struct promise_type
+    {
+        Coroutine get_return_object()
+        {
+            return Coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    explicit Coroutine(std::coroutine_handle<promise_type> handle) noexcept :
+        handle(handle)
+    {
+    }
+
+    Coroutine(Coroutine&& other) noexcept :
+        handle(std::exchange(other.handle, {}))
+    {
+    }
+
+    ~Coroutine()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    Coroutine& operator=(Coroutine&&) = delete;
+
+    [[nodiscard]] bool done() const noexcept
+    {
+        return handle.done();
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+} // namespace signals::test
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#ifndef SIGNALS_TST_COUNTINGRESOURCE_HPP_
+#define SIGNALS_TST_COUNTINGRESOURCE_HPP_
+
+#include <memory_resource>
+
+namespace signals::test
+{
+
+// Memory resource to spy on how many bytes are allocated from it
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingResource(
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) :
+        upstream(upstream)
+    {
+    }
+
+    std::size_t bytesAllocated = 0;
+    std::size_t bytesInUse = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        auto p = upstream->allocate(bytes, alignment);
+        bytesAllocated += bytes;
+        bytesInUse += bytes;
+        return p;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        bytesInUse -= bytes;
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream;
+};
+
+} // namespace signals::test
+
+#endif
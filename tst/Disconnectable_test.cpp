@@ -16,5 +16,29 @@ TEST(DisconnectableTest, IsAbstract)
 {
     EXPECT_TRUE(std::is_abstract_v<Disconnectable>);
 }
+
+TEST(DisconnectableTest, IsNeverBlockedUnlessBlockingIsImplemented)
+{
+    struct Slot : Disconnectable
+    {
+        // LCOV_EXCL_START
+        [[nodiscard]] bool connected() const override
+        {
+            return true;
+        }
+
+        void disconnect() override
+        {
+        }
+        // LCOV_EXCL_STOP
+    };
+
+    auto slot = Slot{};
+    slot.block();
+    EXPECT_FALSE(slot.blocked());
+
+    slot.unblock();
+    EXPECT_FALSE(slot.blocked());
+}
 } // namespace
 } // namespace signals
@@ -0,0 +1,117 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Coroutine.hpp"
+#include <signals/Emissions.hpp>
+#include <signals/EventLoop.hpp>
+#include <signals/Signal.hpp>
+#include <signals/ThreadPool.hpp>
+#include <gmock/gmock.h>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+using Signal = signals::Signal<void(int)>;
+
+signals::test::Coroutine consume(
+    signals::Emissions<Signal>& emissions, std::vector<int>& events)
+{
+    for (;;)
+        events.push_back(co_await emissions.next());
+}
+
+class EmissionsTest : public Test
+{
+protected:
+    Signal signal;
+    std::vector<int> events;
+};
+
+TEST_F(EmissionsTest, ResumeAwaitingCoroutineWithEachEmission)
+{
+    auto emissions = signals::Emissions{signal};
+    const auto coroutine = consume(emissions, events);
+
+    signal(1);
+    signal(2);
+    EXPECT_THAT(events, ElementsAre(1, 2));
+}
+
+TEST_F(EmissionsTest, QueueEmissionsWhileNotAwaiting)
+{
+    auto emissions = signals::Emissions{signal};
+
+    signal(1);
+    signal(2);
+    EXPECT_THAT(emissions.pending(), Eq(2));
+
+    const auto coroutine = consume(emissions, events);
+    EXPECT_THAT(events, ElementsAre(1, 2));
+    EXPECT_THAT(emissions.pending(), Eq(0));
+}
+
+TEST_F(EmissionsTest, ResumeAwaitingCoroutineOnExecutor)
+{
+    auto loop = signals::EventLoop{};
+    auto emissions = signals::Emissions{signal, loop};
+    const auto coroutine = consume(emissions, events);
+
+    signal(1);
+    signal(2);
+    EXPECT_THAT(events, IsEmpty());
+
+    loop.poll();
+    EXPECT_THAT(events, ElementsAre(1, 2));
+}
+
+TEST_F(EmissionsTest, ResumeAwaitingCoroutineOnAnotherThread)
+{
+    auto emissions = std::optional<signals::Emissions<Signal>>{};
+    auto coroutine = std::optional<signals::test::Coroutine>{};
+    {
+        // The pool runs the pending resumptions before it is destroyed
+        auto pool = signals::ThreadPool{1};
+        emissions.emplace(signal, pool);
+        coroutine.emplace(consume(*emissions, events));
+
+        for (auto i = 0; i < 1000; ++i)
+            signal(i);
+    }
+
+    EXPECT_THAT(events, SizeIs(1000));
+    EXPECT_THAT(events.back(), Eq(999));
+}
+
+TEST_F(EmissionsTest, DisconnectWhenDestroyed)
+{
+    {
+        const auto emissions = signals::Emissions{signal};
+        EXPECT_FALSE(signal.empty());
+    }
+
+    EXPECT_TRUE(signal.empty());
+}
+
+signals::test::Coroutine consumeOne(
+    signals::Emissions<signals::Signal<void(int, const std::string&)>>& emissions,
+    std::tuple<int, std::string>& event)
+{
+    event = co_await emissions.next();
+}
+
+TEST_F(EmissionsTest, AwaitEventOfSeveralArgumentsAsTuple)
+{
+    auto pairs = signals::Signal<void(int, const std::string&)>{};
+    auto emissions = signals::Emissions{pairs};
+    auto event = std::tuple<int, std::string>{};
+    const auto coroutine = consumeOne(emissions, event);
+
+    pairs(1, "one");
+    EXPECT_THAT(event, FieldsAre(1, "one"));
+}
+
+} // namespace
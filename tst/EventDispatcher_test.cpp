@@ -0,0 +1,126 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/EventDispatcher.hpp>
+#include <gmock/gmock.h>
+#include <typeindex>
+#include <utility>
+
+namespace
+{
+using namespace testing;
+
+enum class Message
+{
+    Started,
+    Stopped
+};
+
+class EventDispatcherTest : public Test
+{
+protected:
+    signals::EventDispatcher<Message, bool(int)> dispatcher;
+};
+
+TEST_F(EventDispatcherTest, IsEmptyUntilSubscribed)
+{
+    EXPECT_TRUE(dispatcher.empty(Message::Started));
+    EXPECT_THAT(dispatcher.size(), Eq(0));
+
+    dispatcher.subscribe(Message::Started, [](int) {
+        return true;
+    });
+
+    EXPECT_FALSE(dispatcher.empty(Message::Started));
+    EXPECT_TRUE(dispatcher.empty(Message::Stopped));
+    EXPECT_THAT(dispatcher.size(), Eq(1));
+}
+
+TEST_F(EventDispatcherTest, PublishesToTheSubscribersOfTheKey)
+{
+    auto stopped = 0;
+    dispatcher.subscribe(Message::Started, [](int answer) {
+        return answer == 42;
+    });
+    dispatcher.subscribe(Message::Stopped, [&stopped](int) {
+        ++stopped;
+        return false;
+    });
+
+    EXPECT_TRUE(dispatcher(Message::Started, 42));
+    EXPECT_FALSE(dispatcher(Message::Started, 13));
+    EXPECT_THAT(stopped, Eq(0));
+}
+
+TEST_F(EventDispatcherTest, PublishingWithoutSubscribersReturnsWhatEmptySignalDoes)
+{
+    EXPECT_FALSE(dispatcher(Message::Started, 42));
+}
+
+TEST_F(EventDispatcherTest, DispatchesManyKeys)
+{
+    auto ids = signals::EventDispatcher<int, int()>{};
+
+    for (auto id = 0; id < 2000; ++id)
+        ids.subscribe(id, [id] {
+            return id;
+        });
+
+    EXPECT_THAT(ids.size(), Eq(2000));
+
+    for (auto id = 0; id < 2000; ++id)
+        ASSERT_THAT(ids(id), Eq(id));
+
+    EXPECT_THAT(ids(2000), Eq(0));
+}
+
+TEST_F(EventDispatcherTest, DispatchesByTypeIndex)
+{
+    auto types = signals::EventDispatcher<std::type_index, int()>{};
+    types.subscribe(typeid(int), [] {
+        return 1;
+    });
+    types.subscribe(typeid(double), [] {
+        return 2;
+    });
+
+    EXPECT_THAT(types(typeid(int)), Eq(1));
+    EXPECT_THAT(types(typeid(double)), Eq(2));
+    EXPECT_THAT(types(typeid(char)), Eq(0));
+}
+
+TEST_F(EventDispatcherTest, SubscriptionsMoveOverFromSignal)
+{
+    auto signal = signals::Signal<bool(int)>{};
+    auto connection = signal.connect([](int answer) {
+        return answer == 42;
+    });
+
+    dispatcher.signal(Message::Started) = std::move(signal);
+
+    EXPECT_TRUE(dispatcher(Message::Started, 42));
+
+    connection.disconnect();
+
+    EXPECT_TRUE(dispatcher.empty(Message::Started));
+}
+
+TEST_F(EventDispatcherTest, KeysCanBeSubscribedToWhilePublishing)
+{
+    auto ids = signals::EventDispatcher<int, void()>{};
+    auto calls = 0;
+
+    ids.subscribe(0, [&] {
+        for (auto id = 1; id < 100; ++id)
+            ids.subscribe(id, [&calls] {
+                ++calls;
+            });
+    });
+
+    ids(0);
+    ids(99);
+
+    EXPECT_THAT(ids.size(), Eq(100));
+    EXPECT_THAT(calls, Eq(1));
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/EventLoop.hpp>
+#include <gtest/gtest.h>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class EventLoopTest : public Test
+{
+protected:
+    signals::EventLoop loop;
+};
+
+TEST_F(EventLoopTest, IsNoncopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<signals::EventLoop>);
+    EXPECT_FALSE(std::is_copy_assignable_v<signals::EventLoop>);
+}
+
+TEST_F(EventLoopTest, IsExecutor)
+{
+    EXPECT_TRUE((std::is_base_of_v<signals::Executor, signals::EventLoop>));
+}
+
+TEST_F(EventLoopTest, DoNotRunTasksWhenPosted)
+{
+    auto ran = false;
+
+    loop.post([&ran] { ran = true; });
+
+    EXPECT_FALSE(ran);
+}
+
+TEST_F(EventLoopTest, PollRunsPostedTasksInOrder)
+{
+    auto ran = std::vector<int>{};
+
+    loop.post([&ran] { ran.push_back(1); });
+    loop.post([&ran] { ran.push_back(2); });
+
+    EXPECT_EQ(2u, loop.poll());
+    EXPECT_EQ((std::vector{1, 2}), ran);
+    EXPECT_EQ(0u, loop.poll());
+}
+
+TEST_F(EventLoopTest, PollLeavesTasksPostedByTasksForNextPoll)
+{
+    auto ran = 0;
+    auto repost = std::function<void()>{};
+    repost = [&] {
+        ++ran;
+        loop.post(repost);
+    };
+
+    loop.post(repost);
+
+    EXPECT_EQ(1u, loop.poll());
+    EXPECT_EQ(1u, loop.poll());
+    EXPECT_EQ(2, ran);
+}
+
+TEST_F(EventLoopTest, StopWhileTaskKeepsPostingItself)
+{
+    auto repost = std::function<void()>{};
+    repost = [&] { loop.post(repost); };
+
+    loop.post(repost);
+    loop.post([this] { loop.stop(); });
+    loop.run();
+
+    EXPECT_EQ(1u, loop.poll());
+}
+
+TEST_F(EventLoopTest, RunUntilStopped)
+{
+    auto ran = 0;
+
+    loop.post([&ran] { ++ran; });
+    loop.post([this] { loop.stop(); });
+    loop.run();
+
+    EXPECT_EQ(1, ran);
+}
+
+TEST_F(EventLoopTest, RunTasksPostedFromOtherThreads)
+{
+    constexpr auto posts = 1000;
+    auto ran = 0;
+
+    auto producer = std::jthread{[&] {
+        for (auto i = 0; i < posts; ++i)
+            loop.post([&ran] { ++ran; });
+
+        loop.post([this] { loop.stop(); });
+    }};
+
+    loop.run();
+
+    EXPECT_EQ(posts, ran);
+}
+
+TEST_F(EventLoopTest, StopFromOtherThread)
+{
+    auto stopper = std::jthread{[this] { loop.stop(); }};
+
+    loop.run();
+}
+
+TEST_F(EventLoopTest, IsUnnamedByDefault)
+{
+    EXPECT_TRUE(loop.name().empty());
+}
+
+TEST_F(EventLoopTest, FindByName)
+{
+    EXPECT_EQ(nullptr, signals::EventLoop::find("ui"));
+
+    {
+        auto named = signals::EventLoop{"ui"};
+
+        EXPECT_EQ("ui", named.name());
+        EXPECT_EQ(&named, signals::EventLoop::find("ui"));
+    }
+
+    EXPECT_EQ(nullptr, signals::EventLoop::find("ui"));
+}
+
+} // namespace
@@ -0,0 +1,260 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "CountingResource.hpp"
+#include <signals/Function.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <functional>
+#include <memory>
+
+namespace
+{
+using namespace testing;
+
+class FunctionTest : public Test
+{
+protected:
+    using Function = signals::Function<int(int)>;
+
+    signals::test::CountingResource resource;
+};
+
+template<std::size_t Size>
+struct Callable
+{
+    int operator()(int i) const
+    {
+        return values[0] + i;
+    }
+
+    std::array<int, Size> values = {1};
+};
+
+int twice(int i)
+{
+    return 2 * i;
+}
+
+class Payload
+{
+public:
+    explicit Payload(int& copies) :
+        copies(&copies)
+    {
+    }
+
+    Payload(const Payload& other) :
+        copies(other.copies)
+    {
+        ++*copies;
+    }
+
+    Payload(Payload&& other) noexcept = default;
+
+    Payload& operator=(const Payload&) = delete;
+
+    Payload& operator=(Payload&&) = delete;
+
+private:
+    int* copies;
+};
+
+struct Multiplier
+{
+    int multiply(int i) const
+    {
+        return factor * i;
+    }
+
+    int factor;
+};
+
+TEST_F(FunctionTest, IsMoveOnly)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<Function>);
+    EXPECT_FALSE(std::is_copy_assignable_v<Function>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Function>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<Function>);
+}
+
+TEST_F(FunctionTest, IsEmptyByDefault)
+{
+    EXPECT_TRUE(Function{} == nullptr);
+    EXPECT_FALSE(Function{nullptr});
+    EXPECT_THROW(std::invoke(Function{}, 1), std::bad_function_call);
+}
+
+TEST_F(FunctionTest, IsEmptyWhenConstructedFromNullFunctionPointer)
+{
+    EXPECT_FALSE(Function{static_cast<int (*)(int)>(nullptr)});
+}
+
+TEST_F(FunctionTest, IsEmptyWhenConstructedFromEmptyStdFunction)
+{
+    EXPECT_FALSE(Function{std::function<int(int)>{}});
+}
+
+TEST_F(FunctionTest, InvokeFunctionPointer)
+{
+    EXPECT_EQ(42, std::invoke(Function{twice}, 21));
+}
+
+TEST_F(FunctionTest, InvokeBoundFunction)
+{
+    EXPECT_EQ(42, std::invoke(Function{signals::bind<twice>()}, 21));
+}
+
+TEST_F(FunctionTest, InvokeBoundMemberFunction)
+{
+    auto multiplier = Multiplier{3};
+    const auto fn = Function{signals::bind<&Multiplier::multiply>(multiplier)};
+
+    EXPECT_EQ(6, fn(2));
+
+    multiplier.factor = 4;
+    EXPECT_EQ(8, fn(2));
+}
+
+TEST_F(FunctionTest, InvokeMutableCallable)
+{
+    const auto fn = Function{[sum = 0](int i) mutable {
+        return sum += i;
+    }};
+
+    fn(1);
+    EXPECT_EQ(3, fn(2));
+}
+
+TEST_F(FunctionTest, InvokeMoveOnlyCallable)
+{
+    auto fn = Function{[p = std::make_unique<int>(2)](int i) {
+        return *p * i;
+    }};
+
+    const auto moved = std::move(fn);
+
+    EXPECT_FALSE(fn);
+    EXPECT_EQ(42, moved(21));
+}
+
+TEST_F(FunctionTest, DiscardResultWhenReturningVoid)
+{
+    auto called = 0;
+    const auto fn = signals::Function<void(int)>{[&called](int i) {
+        called = i;
+        return i;
+    }};
+
+    fn(42);
+    EXPECT_EQ(42, called);
+}
+
+TEST_F(FunctionTest, DoNotAllocateWhenCallableFitsInline)
+{
+    using Small = Callable<4>;
+    ASSERT_TRUE(Function::storedInline<Small>);
+
+    auto fn = Function{std::allocator_arg, &resource, Small{}};
+    auto moved = std::move(fn);
+
+    EXPECT_EQ(0, resource.bytesAllocated);
+    EXPECT_EQ(2, moved(1));
+}
+
+TEST_F(FunctionTest, AllocateWhenCallableDoesNotFitInline)
+{
+    using Large = Callable<16>;
+    ASSERT_FALSE(Function::storedInline<Large>);
+
+    auto fn = Function{std::allocator_arg, &resource, Large{}};
+    EXPECT_EQ(sizeof(Large), resource.bytesAllocated);
+
+    auto moved = std::move(fn);
+    EXPECT_EQ(sizeof(Large), resource.bytesAllocated);
+    EXPECT_EQ(2, moved(1));
+
+    moved = nullptr;
+    EXPECT_EQ(0, resource.bytesInUse);
+}
+
+TEST_F(FunctionTest, SupportConfigurableCapacity)
+{
+    using Large = Callable<32>;
+    using LargeFunction = signals::Function<int(int), sizeof(Large)>;
+    ASSERT_TRUE(LargeFunction::storedInline<Large>);
+
+    const auto fn = LargeFunction{std::allocator_arg, &resource, Large{}};
+
+    EXPECT_EQ(0, resource.bytesAllocated);
+    EXPECT_EQ(2, fn(1));
+}
+
+TEST_F(FunctionTest, DestroyCallableWhenReset)
+{
+    auto counter = std::make_shared<int>();
+    auto fn = Function{[counter](int i) {
+        return *counter + i;
+    }};
+    ASSERT_EQ(2, counter.use_count());
+
+    fn = nullptr;
+    EXPECT_EQ(1, counter.use_count());
+}
+
+TEST_F(FunctionTest, MoveArgumentsTakenByValueToCallable)
+{
+    auto copies = 0;
+    const auto fn = signals::Function<void(Payload)>{[](Payload) {}};
+
+    fn(Payload{copies});
+    EXPECT_EQ(0, copies);
+}
+
+TEST_F(FunctionTest, DoNotCopyArgumentsWhenCalledForCallableTakingConstReference)
+{
+    auto copies = 0;
+    const auto payload = Payload{copies};
+    const auto fn = signals::Function<void(Payload)>{[](const Payload&) {}};
+
+    fn.call(payload);
+    EXPECT_EQ(0, copies);
+}
+
+TEST_F(FunctionTest, CopyArgumentsOnceWhenCalledForCallableTakingValue)
+{
+    auto copies = 0;
+    const auto payload = Payload{copies};
+    const auto byValue = signals::Function<void(Payload)>{[](Payload) {}};
+    const auto byRvalue = signals::Function<void(Payload)>{[](Payload&&) {}};
+
+    byValue.call(payload);
+    EXPECT_EQ(1, copies);
+
+    byRvalue.call(payload);
+    EXPECT_EQ(2, copies);
+}
+
+TEST_F(FunctionTest, PassReferenceArgumentsAsTheyAreWhenCalled)
+{
+    auto n = 1;
+    const auto fn = signals::Function<void(int&)>{[](int& i) { i *= 2; }};
+
+    fn.call(n);
+    EXPECT_EQ(2, n);
+}
+
+TEST_F(FunctionTest, RejectTargetTakingMoveOnlyArgumentByValue)
+{
+    using Pointer = std::unique_ptr<int>;
+    using Fn = signals::Function<void(Pointer)>;
+
+    EXPECT_TRUE((std::is_constructible_v<Fn, void (*)(const Pointer&)>));
+    EXPECT_FALSE((std::is_constructible_v<Fn, void (*)(Pointer)>));
+    EXPECT_FALSE((std::is_constructible_v<Fn, void (*)(Pointer&&)>));
+}
+
+TEST_F(FunctionTest, ThrowWhenCalledWhileEmpty)
+{
+    EXPECT_THROW(Function{}.call(1), std::bad_function_call);
+}
+} // namespace
@@ -0,0 +1,188 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Allocations.hpp"
+#include <signals/InplaceSignal.hpp>
+#include <signals/ScopedConnection.hpp>
+#include <gmock/gmock.h>
+#include <array>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class InplaceSignalTest : public Test
+{
+protected:
+    using Signal = signals::InplaceSignal<void(int&), 3>;
+
+    static auto add(int i)
+    {
+        return [i](int& n) {
+            n += i;
+        };
+    }
+
+    Signal signal;
+};
+
+template<typename R>
+struct Collector
+{
+    template<typename Slots, typename... Args>
+    auto operator()(Slots slots, Args&&... args) const
+    {
+        auto r = R{};
+
+        for (auto& slot : slots)
+            r.push_back(std::invoke(*slot, args...));
+
+        return r;
+    }
+};
+
+TEST_F(InplaceSignalTest, IsEmptyByDefault)
+{
+    EXPECT_TRUE(signal.empty());
+    EXPECT_EQ(0, signal.num_slots());
+    EXPECT_EQ(3, Signal::capacity());
+}
+
+TEST_F(InplaceSignalTest, EmitToConnectedSlotsInOrder)
+{
+    auto result = 1;
+    signal.connect(add(1));
+    signal.connect([](int& n) { n *= 10; });
+
+    signal(result);
+    EXPECT_EQ(20, result);
+    EXPECT_EQ(2, signal.num_slots());
+}
+
+TEST_F(InplaceSignalTest, FailToConnectWhenFull)
+{
+    signal.connect(add(1));
+    signal.connect(add(2));
+    signal.connect(add(3));
+
+    EXPECT_EQ(std::nullopt, signal.connect(add(4)));
+    EXPECT_EQ(3, signal.num_slots());
+
+    auto result = 0;
+    signal(result);
+    EXPECT_EQ(6, result);
+}
+
+TEST_F(InplaceSignalTest, ReuseDisconnectedSlotsWhenFull)
+{
+    signal.connect(add(1));
+    auto connection = *signal.connect(add(2));
+    signal.connect(add(3));
+    connection.disconnect();
+
+    const auto reconnected = signal.connect(add(4));
+
+    auto result = 0;
+    signal(result);
+    EXPECT_EQ(8, result);
+    EXPECT_FALSE(connection.connected());
+    ASSERT_TRUE(reconnected);
+    EXPECT_TRUE(reconnected->connected());
+}
+
+TEST_F(InplaceSignalTest, ReturnConnectionThatIsNotConnectedForEmptyCallable)
+{
+    const auto connection = signal.connect(static_cast<void (*)(int&)>(nullptr));
+
+    ASSERT_TRUE(connection);
+    EXPECT_FALSE(connection->connected());
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(InplaceSignalTest, DisconnectWhenScopedConnectionGoesOutOfScope)
+{
+    {
+        const auto scoped = signals::ScopedConnection{*signal.connect(add(1))};
+        EXPECT_FALSE(signal.empty());
+    }
+
+    auto result = 0;
+    signal(result);
+    EXPECT_EQ(0, result);
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(InplaceSignalTest, DisconnectWhenSignalIsDestroyedBeforeScopedConnection)
+{
+    auto scoped = signals::ScopedConnection{};
+    {
+        auto temporary = Signal{};
+        scoped = *temporary.connect(add(1));
+        EXPECT_TRUE(scoped.connected());
+    }
+    EXPECT_FALSE(scoped.connected());
+}
+
+TEST_F(InplaceSignalTest, DisconnectAllSlotsOnClear)
+{
+    const auto connection = *signal.connect(add(1));
+    signal.connect(add(2));
+
+    signal.clear();
+
+    auto result = 0;
+    signal(result);
+    EXPECT_EQ(0, result);
+    EXPECT_TRUE(signal.empty());
+    EXPECT_FALSE(connection.connected());
+}
+
+TEST_F(InplaceSignalTest, DoNotInvokeSlotDisconnectedDuringEmission)
+{
+    auto connection = signals::Connection{};
+    signal.connect([&connection](int&) { connection.disconnect(); });
+    connection = *signal.connect(add(1));
+
+    auto result = 0;
+    signal(result);
+    EXPECT_EQ(0, result);
+}
+
+TEST_F(InplaceSignalTest, DoNotAllocateOnConnectEmitOrDisconnect)
+{
+    const auto bytesBefore = signals::test::bytesAllocated();
+    {
+        auto connection = *signal.connect(add(1));
+        const auto scoped = signals::ScopedConnection{*signal.connect(add(2))};
+
+        auto result = 0;
+        signal(result);
+        connection.disconnect();
+        signal.connect(add(3));
+        signal.clear();
+    }
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+}
+
+TEST_F(InplaceSignalTest, DoNotAllocateWhenFailingToConnect)
+{
+    signal.connect(add(1));
+    signal.connect(add(2));
+    signal.connect(add(3));
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    const auto connection = signal.connect(add(4));
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+    EXPECT_EQ(std::nullopt, connection);
+}
+
+TEST_F(InplaceSignalTest, SupportCustomResultCombiner)
+{
+    auto collection = signals::InplaceSignal<int(), 2, Collector<std::vector<int>>>{};
+    collection.connect([] { return 1; });
+    collection.connect([] { return 2; });
+
+    EXPECT_THAT(collection(), ElementsAre(1, 2));
+}
+
+} // namespace
@@ -0,0 +1,191 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/Instrumentation.hpp>
+#include <signals/ParallelCombiner.hpp>
+#include <signals/Signal.hpp>
+#include <gmock/gmock.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class InstrumentationTest : public Test
+{
+protected:
+    using Signal = signals::Signal<
+        int(int), signals::DefaultCombiner<int>, signals::EmissionMetrics>;
+
+    [[nodiscard]] signals::EmissionMetrics::Snapshot metrics() const
+    {
+        return signal.instrumentation().snapshot();
+    }
+
+    Signal signal;
+};
+
+auto sumOf(const std::array<std::uint64_t, signals::EmissionMetrics::latencyBuckets>& latency)
+{
+    return std::accumulate(latency.begin(), latency.end(), std::uint64_t{0});
+}
+
+TEST_F(InstrumentationTest, CountsEmissionsAndInvokedSlots)
+{
+    signal.connect([](int i) {
+        return i;
+    });
+    signal.connect([](int i) {
+        return i * 2;
+    });
+
+    EXPECT_THAT(signal(1), Eq(2));
+    EXPECT_THAT(signal.emit_moving(2), Eq(4));
+    EXPECT_THAT(metrics().emissions, Eq(2));
+    EXPECT_THAT(metrics().invocations, Eq(4));
+    EXPECT_THAT(metrics().skipped, Eq(0));
+}
+
+TEST_F(InstrumentationTest, RecordsLatencyOfEverySlotCall)
+{
+    signal.connect([](int i) {
+        return i;
+    });
+
+    for (auto i = 0; i < 3; ++i)
+        signal(i);
+
+    EXPECT_THAT(sumOf(metrics().latency), Eq(3));
+}
+
+TEST_F(InstrumentationTest, CountsSkippedSlotsAsDead)
+{
+    auto connection = signal.connect([](int i) {
+        return i;
+    });
+    signal.connect([](int i) {
+        return i;
+    });
+    connection.block();
+
+    signal(1);
+
+    EXPECT_THAT(metrics().invocations, Eq(1));
+    EXPECT_THAT(metrics().skipped, Eq(1));
+    EXPECT_THAT(metrics().deadSlotRatio(), DoubleEq(0.5));
+}
+
+TEST_F(InstrumentationTest, DeadSlotRatioIsZeroBeforeAnySlotIsReached)
+{
+    signal(1);
+
+    EXPECT_THAT(metrics().emissions, Eq(1));
+    EXPECT_THAT(metrics().deadSlotRatio(), DoubleEq(0.0));
+}
+
+TEST_F(InstrumentationTest, MovedSignalRecordsInItsOwnMetrics)
+{
+    signal.connect([](int i) {
+        return i;
+    });
+
+    auto moved = std::move(signal);
+
+    EXPECT_THAT(moved(3), Eq(3));
+    EXPECT_THAT(moved.instrumentation().snapshot().invocations, Eq(1));
+    EXPECT_THAT(metrics().invocations, Eq(0));
+}
+
+TEST_F(InstrumentationTest, TimesSlotsCalledByAnyCombiner)
+{
+    auto parallel = signals::Signal<
+        int(int), signals::ParallelCombiner<int>, signals::EmissionMetrics>{};
+
+    for (auto i = 0; i < 4; ++i)
+        parallel.connect([i](int n) {
+            return n + i;
+        });
+
+    EXPECT_THAT(parallel(1), ElementsAre(1, 2, 3, 4));
+    EXPECT_THAT(parallel.instrumentation().snapshot().invocations, Eq(4));
+}
+
+TEST_F(InstrumentationTest, CountsBatchEmissions)
+{
+    auto batched = signals::Signal<
+        void(int), signals::DefaultCombiner<void>, signals::EmissionMetrics>{};
+    auto sum = 0;
+    batched.connect([&sum](int i) {
+        sum += i;
+    });
+
+    const auto events = std::vector{1, 2, 3};
+    batched.emit_batch(events);
+
+    EXPECT_THAT(sum, Eq(6));
+    EXPECT_THAT(batched.instrumentation().snapshot().emissions, Eq(1));
+    EXPECT_THAT(batched.instrumentation().snapshot().invocations, Eq(1));
+}
+
+TEST_F(InstrumentationTest, DoesNotRecordIntoMetricsOfSignalDestroyedBySlot)
+{
+    auto owned = std::make_unique<signals::Signal<
+        void(), signals::DefaultCombiner<void>, signals::EmissionMetrics>>();
+    auto invoked = 0;
+    owned->connect([&owned, &invoked] {
+        ++invoked;
+        owned.reset();
+    });
+    owned->connect([&invoked] {
+        ++invoked;
+    });
+
+    (*owned)();
+
+    EXPECT_THAT(invoked, Eq(1));
+}
+
+TEST_F(InstrumentationTest, TimesSlotConnectingWhileEmitting)
+{
+    auto timed =
+        signals::Signal<void(), signals::DefaultCombiner<void>, signals::EmissionMetrics>{};
+    timed.connect([&timed] {
+        // Enough slots to outgrow the timed slots while this one is still being called
+        for (auto i = 0; i < 64; ++i)
+            timed.connect([] {});
+    });
+
+    timed();
+
+    EXPECT_THAT(timed.num_slots(), Eq(65));
+    EXPECT_THAT(timed.instrumentation().snapshot().invocations, Eq(1));
+}
+
+TEST_F(InstrumentationTest, RegistrySnapshotsPublishedMetricsWhileTheyExist)
+{
+    signal.instrumentation().publish("tick");
+    signal.connect([](int i) {
+        return i;
+    });
+    signal(1);
+
+    {
+        auto other = signals::EmissionMetrics{};
+        other.publish("alarm");
+
+        const auto entries = signals::MetricsRegistry::snapshot();
+
+        ASSERT_THAT(entries, SizeIs(2));
+        EXPECT_THAT(entries[0].first, Eq("alarm"));
+        EXPECT_THAT(entries[1].first, Eq("tick"));
+        EXPECT_THAT(entries[1].second.invocations, Eq(1));
+    }
+
+    EXPECT_THAT(signals::MetricsRegistry::snapshot(), SizeIs(1));
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/IntrusivePtr.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace testing;
+
+class Counted
+{
+public:
+    void retain() noexcept
+    {
+        ++references;
+    }
+
+    void release() noexcept
+    {
+        --references;
+    }
+
+    int references = 0;
+};
+
+class IntrusivePtrTest : public Test
+{
+protected:
+    using Ptr = signals::IntrusivePtr<Counted>;
+
+    Counted counted;
+};
+
+TEST_F(IntrusivePtrTest, IsNothrowCopyableAndMoveable)
+{
+    EXPECT_TRUE(std::is_nothrow_copy_constructible_v<Ptr>);
+    EXPECT_TRUE(std::is_nothrow_copy_assignable_v<Ptr>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Ptr>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<Ptr>);
+}
+
+TEST_F(IntrusivePtrTest, IsNullByDefault)
+{
+    EXPECT_FALSE(Ptr{});
+    EXPECT_EQ(nullptr, Ptr{}.get());
+}
+
+TEST_F(IntrusivePtrTest, RetainWhileReferenced)
+{
+    {
+        const auto ptr = Ptr{&counted};
+        EXPECT_EQ(1, counted.references);
+        EXPECT_EQ(&counted, ptr.get());
+
+        const auto copy = ptr;
+        EXPECT_EQ(2, counted.references);
+    }
+    EXPECT_EQ(0, counted.references);
+}
+
+TEST_F(IntrusivePtrTest, DoNotRetainWhenMoved)
+{
+    auto source = Ptr{&counted};
+
+    const auto target = std::move(source);
+
+    EXPECT_FALSE(source);
+    EXPECT_EQ(&counted, target.get());
+    EXPECT_EQ(1, counted.references);
+}
+
+TEST_F(IntrusivePtrTest, ReleaseWhenAssigned)
+{
+    auto other = Counted{};
+    auto ptr = Ptr{&counted};
+
+    ptr = Ptr{&other};
+    EXPECT_EQ(0, counted.references);
+    EXPECT_EQ(1, other.references);
+
+    ptr.reset();
+    EXPECT_EQ(0, other.references);
+}
+
+TEST_F(IntrusivePtrTest, IsSelfAssignmentSafe)
+{
+    auto ptr = Ptr{&counted};
+    const auto self = &ptr;
+
+    ptr = *self;
+    ptr = std::move(*self);
+
+    EXPECT_EQ(&counted, ptr.get());
+    EXPECT_EQ(1, counted.references);
+}
+} // namespace
@@ -0,0 +1,115 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Allocations.hpp"
+#include <signals/MpscQueue.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class MpscQueueTest : public Test
+{
+protected:
+    signals::MpscQueue<int> queue;
+};
+
+TEST_F(MpscQueueTest, IsNoncopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<signals::MpscQueue<int>>);
+    EXPECT_FALSE(std::is_copy_assignable_v<signals::MpscQueue<int>>);
+}
+
+TEST_F(MpscQueueTest, IsEmptyByDefault)
+{
+    EXPECT_FALSE(queue.pop());
+}
+
+TEST_F(MpscQueueTest, PopInPushOrder)
+{
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    EXPECT_EQ(1, queue.pop());
+    EXPECT_EQ(2, queue.pop());
+    EXPECT_EQ(3, queue.pop());
+    EXPECT_FALSE(queue.pop());
+}
+
+TEST_F(MpscQueueTest, PushMoveOnlyValue)
+{
+    auto q = signals::MpscQueue<std::unique_ptr<int>>{};
+
+    q.push(std::make_unique<int>(42));
+
+    EXPECT_EQ(42, *q.pop().value());
+}
+
+TEST_F(MpscQueueTest, DestroyPendingValues)
+{
+    auto value = std::make_shared<int>(42);
+
+    {
+        auto q = signals::MpscQueue<std::shared_ptr<int>>{};
+        q.push(value);
+        q.push(value);
+        EXPECT_EQ(3, value.use_count());
+    }
+
+    EXPECT_EQ(1, value.use_count());
+}
+
+TEST_F(MpscQueueTest, ReuseNodesOfPoppedValues)
+{
+    queue.push(1);
+    queue.push(2);
+    queue.pop();
+    queue.pop();
+
+    const auto allocated = signals::test::bytesAllocated();
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        queue.push(i);
+        queue.push(i);
+        EXPECT_EQ(i, queue.pop());
+        EXPECT_EQ(i, queue.pop());
+    }
+
+    EXPECT_EQ(allocated, signals::test::bytesAllocated());
+}
+
+TEST_F(MpscQueueTest, PushFromMultipleThreads)
+{
+    constexpr auto producers = 4;
+    constexpr auto pushes = 10000;
+
+    auto threads = std::vector<std::jthread>{};
+
+    for (auto p = 0; p < producers; ++p)
+        threads.emplace_back([this, p] {
+            for (auto i = 0; i < pushes; ++i)
+                queue.push(p * pushes + i);
+        });
+
+    auto last = std::vector<int>(producers, -1);
+
+    for (auto popped = 0; popped < producers * pushes;)
+    {
+        if (const auto value = queue.pop())
+        {
+            // The values of each producer must be popped in the order they were pushed
+            EXPECT_LT(last[*value / pushes], *value % pushes);
+            last[*value / pushes] = *value % pushes;
+            ++popped;
+        }
+    }
+
+    EXPECT_FALSE(queue.pop());
+}
+
+} // namespace
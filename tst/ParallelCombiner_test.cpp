@@ -0,0 +1,212 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentSignal.hpp>
+#include <signals/ParallelCombiner.hpp>
+#include <signals/Signal.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+using namespace testing;
+
+struct TestPool
+{
+    signals::ThreadPool& operator()() const
+    {
+        static auto pool = signals::ThreadPool{3};
+        return pool;
+    }
+};
+
+class ParallelCombinerTest : public Test
+{
+protected:
+    template<typename Signature>
+    using Signal = signals::Signal<
+        Signature,
+        signals::ParallelCombiner<typename signals::Slot<Signature>::Result, TestPool>>;
+
+    template<typename R, typename Reduce = std::plus<R>>
+    using ReducingSignal =
+        signals::Signal<R(int), signals::ParallelReduceCombiner<R, Reduce, TestPool>>;
+};
+
+TEST_F(ParallelCombinerTest, UseSharedPoolByDefault)
+{
+    EXPECT_EQ(&signals::ThreadPool::shared(), &signals::SharedThreadPool{}());
+}
+
+TEST_F(ParallelCombinerTest, EmitWithoutSlots)
+{
+    EXPECT_TRUE(Signal<int()>{}().empty());
+    EXPECT_NO_THROW(Signal<void()>{}());
+}
+
+TEST_F(ParallelCombinerTest, CallEverySlot)
+{
+    auto signal = Signal<void(int)>{};
+    auto sum = std::atomic<int>{0};
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([&sum](int i) { sum += i; });
+
+    signal(2);
+
+    EXPECT_EQ(200, sum);
+}
+
+TEST_F(ParallelCombinerTest, ReturnResultsInConnectionOrder)
+{
+    auto signal = Signal<int(int)>{};
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([i](int j) { return i * j; });
+
+    const auto results = signal(2);
+
+    ASSERT_EQ(100u, results.size());
+
+    for (auto i = 0; i < 100; ++i)
+        EXPECT_EQ(i * 2, results[static_cast<std::size_t>(i)]);
+}
+
+TEST_F(ParallelCombinerTest, ReturnBoolResultsOfEverySlot)
+{
+    auto signal = Signal<bool(int)>{};
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([i](int j) { return i % j == 0; });
+
+    const auto results = signal(3);
+
+    ASSERT_EQ(100u, results.size());
+
+    for (auto i = 0; i < 100; ++i)
+        EXPECT_EQ(i % 3 == 0, results[static_cast<std::size_t>(i)]);
+}
+
+TEST_F(ParallelCombinerTest, SkipDisconnectedSlots)
+{
+    auto signal = Signal<int()>{};
+    signal.connect([] { return 1; });
+    signal.connect([] { return 2; }).disconnect();
+    signal.connect([] { return 3; });
+
+    EXPECT_EQ((std::vector{1, 3}), signal());
+}
+
+TEST_F(ParallelCombinerTest, CallSlotsOnMultipleThreads)
+{
+    auto signal = Signal<void()>{};
+    auto mutex = std::mutex{};
+    auto threads = std::set<std::thread::id>{};
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([&] {
+            const auto lock = std::scoped_lock{mutex};
+            threads.insert(std::this_thread::get_id());
+        });
+
+    // The pool has to be busy for the other threads to take part,
+    // so keep emitting until they have
+    for (auto i = 0; i < 1000 && threads.size() < 2; ++i)
+        signal();
+
+    EXPECT_LE(2u, threads.size());
+}
+
+TEST_F(ParallelCombinerTest, RethrowExceptionAfterAllSlotsHaveFinished)
+{
+    auto signal = Signal<void()>{};
+    auto running = std::atomic<int>{0};
+
+    signal.connect([] { throw std::runtime_error{"slot"}; });
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([&running] {
+            ++running;
+            std::this_thread::yield();
+            --running;
+        });
+
+    EXPECT_THROW(signal(), std::runtime_error);
+    EXPECT_EQ(0, running);
+}
+
+TEST_F(ParallelCombinerTest, EmitFromWithinPool)
+{
+    // The inner signal is emitted concurrently by the slots of the outer one
+    auto inner = signals::ConcurrentSignal<int(), signals::ParallelCombiner<int, TestPool>>{};
+
+    for (auto i = 0; i < 10; ++i)
+        inner.connect([] { return 1; });
+
+    auto outer = Signal<int()>{};
+
+    for (auto i = 0; i < 10; ++i)
+        outer.connect([&inner] { return static_cast<int>(inner().size()); });
+
+    EXPECT_EQ(std::vector<int>(10, 10), outer());
+}
+
+TEST_F(ParallelCombinerTest, EmitConcurrentSignal)
+{
+    auto signal = signals::ConcurrentSignal<int(), signals::ParallelCombiner<int, TestPool>>{};
+    signal.connect([] { return 1; });
+    signal.connect([] { return 2; });
+
+    EXPECT_EQ((std::vector{1, 2}), signal());
+}
+
+TEST_F(ParallelCombinerTest, ReduceResults)
+{
+    auto signal = ReducingSignal<int>{};
+
+    for (auto i = 1; i <= 100; ++i)
+        signal.connect([i](int j) { return i * j; });
+
+    EXPECT_EQ(5050 * 2, signal(2));
+}
+
+TEST_F(ParallelCombinerTest, ReduceWithoutSlots)
+{
+    EXPECT_EQ(0, ReducingSignal<int>{}(1));
+}
+
+TEST_F(ParallelCombinerTest, ReduceInConnectionOrder)
+{
+    auto signal = ReducingSignal<std::string>{};
+
+    for (auto i = 0; i < 26; ++i)
+        signal.connect([i](int) { return std::string(1, static_cast<char>('a' + i)); });
+
+    EXPECT_EQ("abcdefghijklmnopqrstuvwxyz", signal(0));
+}
+
+TEST_F(ParallelCombinerTest, ReduceBoolResults)
+{
+    auto signal = ReducingSignal<bool, std::logical_and<bool>>{};
+
+    for (auto i = 0; i < 100; ++i)
+        signal.connect([i](int j) { return i != j; });
+
+    EXPECT_TRUE(signal(100));
+    EXPECT_FALSE(signal(99));
+}
+
+TEST_F(ParallelCombinerTest, ReduceWithoutIdentityValue)
+{
+    auto signal = ReducingSignal<int, std::multiplies<int>>{};
+
+    for (auto i = 1; i <= 5; ++i)
+        signal.connect([i](int) { return i; });
+
+    EXPECT_EQ(120, signal(0));
+}
+
+} // namespace
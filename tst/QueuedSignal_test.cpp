@@ -0,0 +1,210 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include "Allocations.hpp"
+#include <signals/QueuedSignal.hpp>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+using signals::Backpressure;
+
+class QueuedSignalTest : public Test
+{
+protected:
+    signals::QueuedSignal<void(int), 4> signal;
+    std::vector<int> received;
+};
+
+TEST_F(QueuedSignalTest, DoNotCallSlotsWhenEmitting)
+{
+    signal.connect([this](int i) {
+        received.push_back(i);
+    });
+
+    EXPECT_TRUE(signal(1));
+    EXPECT_THAT(received, IsEmpty());
+}
+
+TEST_F(QueuedSignalTest, CallSlotsWithQueuedEventsWhenDrained)
+{
+    signal.connect([this](int i) {
+        received.push_back(i);
+    });
+    signal(1);
+    signal(2);
+
+    EXPECT_THAT(signal.drain(), Eq(2));
+    EXPECT_THAT(received, ElementsAre(1, 2));
+    EXPECT_THAT(signal.drain(), Eq(0));
+}
+
+TEST_F(QueuedSignalTest, CallBatchSlotOncePerDrainedBatch)
+{
+    auto batches = std::vector<std::vector<int>>{};
+    signal.connect([&batches](std::span<const int> events) {
+        batches.emplace_back(events.begin(), events.end());
+    });
+    signal(1);
+    signal(2);
+    signal(3);
+
+    signal.drain();
+    EXPECT_THAT(batches, ElementsAre(ElementsAre(1, 2, 3)));
+}
+
+TEST_F(QueuedSignalTest, DrainAtMostOneBufferOfEvents)
+{
+    signal.connect([this](int i) {
+        received.push_back(i);
+        signal(i + 4);
+    });
+
+    for (auto i = 0; i < 4; ++i)
+        signal(i);
+
+    EXPECT_THAT(signal.drain(), Eq(4));
+    EXPECT_THAT(received, ElementsAre(0, 1, 2, 3));
+    EXPECT_THAT(signal.drain(), Eq(4));
+    EXPECT_THAT(received, SizeIs(8));
+}
+
+TEST_F(QueuedSignalTest, DoNotAllocatePerEvent)
+{
+    signal.connect([this](int i) {
+        received.push_back(i);
+    });
+    received.reserve(4);
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    signal(1);
+    signal(2);
+    signal.drain();
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+}
+
+TEST_F(QueuedSignalTest, DropNewestEventWhenFull)
+{
+    auto dropping = signals::QueuedSignal<void(int), 2, Backpressure::DropNewest>{};
+    dropping.connect([this](int i) {
+        received.push_back(i);
+    });
+
+    EXPECT_TRUE(dropping(1));
+    EXPECT_TRUE(dropping(2));
+    EXPECT_FALSE(dropping(3));
+
+    dropping.drain();
+    EXPECT_THAT(received, ElementsAre(1, 2));
+    EXPECT_THAT(dropping.dropped(), Eq(1));
+}
+
+TEST_F(QueuedSignalTest, DropOldestEventWhenFull)
+{
+    auto dropping = signals::QueuedSignal<void(int), 2, Backpressure::DropOldest>{};
+    dropping.connect([this](int i) {
+        received.push_back(i);
+    });
+
+    dropping(1);
+    dropping(2);
+    EXPECT_TRUE(dropping(3));
+
+    dropping.drain();
+    EXPECT_THAT(received, ElementsAre(2, 3));
+    EXPECT_THAT(dropping.dropped(), Eq(1));
+}
+
+template<typename Signal>
+void expectProducerWaitsForConsumer(Signal& signal)
+{
+    constexpr auto events = 100;
+    auto sum = 0;
+    signal.connect([&sum](int i) {
+        sum += i;
+    });
+
+    auto producer = std::jthread{[&signal] {
+        for (auto i = 1; i <= events; ++i)
+            signal(i);
+    }};
+
+    for (auto drained = std::size_t{0}; drained < events;)
+        if (const auto n = signal.drain(); n != 0)
+            drained += n;
+        else
+            std::this_thread::yield();
+
+    producer.join();
+    EXPECT_EQ(events * (events + 1) / 2, sum);
+    EXPECT_EQ(0, signal.dropped());
+}
+
+TEST_F(QueuedSignalTest, BlockProducerUntilDrained)
+{
+    auto blocking = signals::QueuedSignal<void(int), 4, Backpressure::Block>{};
+    expectProducerWaitsForConsumer(blocking);
+}
+
+TEST_F(QueuedSignalTest, SpinProducerUntilDrained)
+{
+    auto spinning = signals::QueuedSignal<void(int), 4, Backpressure::Spin>{};
+    expectProducerWaitsForConsumer(spinning);
+}
+
+TEST_F(QueuedSignalTest, QueueArgumentsByValue)
+{
+    auto strings = signals::QueuedSignal<void(const std::string&, int), 4>{};
+    auto events = std::vector<std::tuple<std::string, int>>{};
+    strings.connect([&events](const std::string& s, int i) {
+        events.emplace_back(s, i);
+    });
+
+    {
+        const auto temporary = std::string{"queued"};
+        strings(temporary, 1);
+    }
+
+    strings.drain();
+    EXPECT_THAT(events, ElementsAre(FieldsAre("queued", 1)));
+}
+
+struct CountingCombiner
+{
+    static inline auto calls = 0;
+
+    template<typename Slots, typename... Args>
+    void operator()(Slots slots, Args&&... args) const
+    {
+        ++calls;
+
+        for (auto& slot : slots)
+            std::invoke(*slot, args...);
+    }
+};
+
+TEST_F(QueuedSignalTest, UseCombinerOncePerEvent)
+{
+    using Combined =
+        signals::QueuedSignal<void(int), 4, Backpressure::Block, CountingCombiner>;
+
+    auto combined = Combined{};
+    combined.connect([this](int i) {
+        received.push_back(i);
+    });
+    combined(1);
+    combined(2);
+
+    combined.drain();
+    EXPECT_THAT(received, ElementsAre(1, 2));
+    EXPECT_THAT(CountingCombiner::calls, Eq(2));
+}
+
+} // namespace
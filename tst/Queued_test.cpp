@@ -0,0 +1,169 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ConcurrentSignal.hpp>
+#include <signals/Queued.hpp>
+#include <signals/Signal.hpp>
+#include <signals/ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <latch>
+#include <memory>
+#include <string>
+
+namespace
+{
+using namespace testing;
+
+class Copyable
+{
+public:
+    Copyable() = default;
+
+    Copyable(const Copyable& other) :
+        copies(other.copies + 1),
+        moves(other.moves)
+    {
+    }
+
+    Copyable(Copyable&& other) noexcept :
+        copies(other.copies),
+        moves(other.moves + 1)
+    {
+    }
+
+    Copyable& operator=(const Copyable&) = delete;
+
+    Copyable& operator=(Copyable&&) = delete;
+
+    int copies = 0;
+    int moves = 0;
+};
+
+class QueuedTest : public Test
+{
+protected:
+    signals::EventLoop loop;
+};
+
+TEST_F(QueuedTest, CallOnExecutor)
+{
+    auto signal = signals::Signal<void(int)>{};
+    auto received = 0;
+    signal.connect(signals::queued(loop, [&received](int i) { received = i; }));
+
+    signal(42);
+    EXPECT_EQ(0, received);
+
+    loop.poll();
+    EXPECT_EQ(42, received);
+}
+
+TEST_F(QueuedTest, CallDirectAndQueuedSlots)
+{
+    auto signal = signals::Signal<void()>{};
+    auto direct = 0;
+    auto queued = 0;
+    signal.connect([&direct] { ++direct; });
+    signal.connect(signals::queued(loop, [&queued] { ++queued; }));
+
+    signal();
+    EXPECT_EQ(1, direct);
+    EXPECT_EQ(0, queued);
+
+    loop.poll();
+    EXPECT_EQ(1, queued);
+}
+
+TEST_F(QueuedTest, CopyArgumentsOnceAndMoveThemToTarget)
+{
+    auto signal = signals::Signal<void(const Copyable&)>{};
+    auto copies = -1;
+    signal.connect(signals::queued(loop, [&copies](Copyable c) { copies = c.copies; }));
+
+    signal(Copyable{});
+    loop.poll();
+
+    EXPECT_EQ(1, copies);
+}
+
+TEST_F(QueuedTest, CopyArgumentsThatDoNotOutliveEmission)
+{
+    auto signal = signals::Signal<void(const std::string&)>{};
+    auto received = std::string{};
+    signal.connect(signals::queued(loop, [&received](std::string s) { received = s; }));
+
+    signal(std::string(100, 'x'));
+    loop.poll();
+
+    EXPECT_EQ(std::string(100, 'x'), received);
+}
+
+TEST_F(QueuedTest, MoveOnlyTarget)
+{
+    auto signal = signals::Signal<void()>{};
+    auto called = false;
+    signal.connect(
+        signals::queued(loop, [&called, p = std::make_unique<int>()] { called = true; }));
+
+    signal();
+    loop.poll();
+
+    EXPECT_TRUE(called);
+}
+
+TEST_F(QueuedTest, DoNotCallPendingAfterDisconnect)
+{
+    auto signal = signals::Signal<void()>{};
+    auto called = false;
+    auto connection = signal.connect(signals::queued(loop, [&called] { called = true; }));
+
+    signal();
+    connection.disconnect();
+    loop.poll();
+
+    EXPECT_FALSE(called);
+}
+
+TEST_F(QueuedTest, DoNotCallPendingAfterDisconnectFromConcurrentSignal)
+{
+    auto signal = signals::ConcurrentSignal<void()>{};
+    auto calls = 0;
+    auto connection = signal.connect(signals::queued(loop, [&calls] { ++calls; }));
+
+    signal();
+    connection.disconnect();
+    loop.poll();
+
+    EXPECT_EQ(0, calls);
+}
+
+TEST_F(QueuedTest, CallOnNamedEventLoop)
+{
+    auto named = signals::EventLoop{"worker"};
+    auto signal = signals::Signal<void()>{};
+    auto called = false;
+    signal.connect(signals::queued("worker", [&called] { called = true; }));
+
+    signal();
+    named.poll();
+
+    EXPECT_TRUE(called);
+}
+
+TEST_F(QueuedTest, ThrowOnUnknownEventLoop)
+{
+    EXPECT_THROW(signals::queued("unknown", [] {}), std::invalid_argument);
+}
+
+TEST_F(QueuedTest, CallOnThreadPool)
+{
+    auto done = std::latch{1};
+    auto pool = signals::ThreadPool{1};
+    auto signal = signals::ConcurrentSignal<void()>{};
+    signal.connect(signals::queued(pool, [&done] { done.count_down(); }));
+
+    signal();
+
+    done.wait();
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/Rcu.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace
+{
+using namespace testing;
+
+class Counted
+{
+public:
+    explicit Counted(int& instances) :
+        instances(instances)
+    {
+        ++instances;
+    }
+
+    ~Counted()
+    {
+        --instances;
+    }
+
+private:
+    int& instances;
+};
+
+class RcuTest : public Test
+{
+protected:
+    signals::Rcu<int> rcu{std::make_unique<const int>(42)};
+};
+
+TEST_F(RcuTest, IsNoncopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<signals::Rcu<int>>);
+    EXPECT_FALSE(std::is_copy_assignable_v<signals::Rcu<int>>);
+}
+
+TEST_F(RcuTest, IsValueInitializedByDefault)
+{
+    EXPECT_EQ(0, signals::Rcu<int>{}.current());
+}
+
+TEST_F(RcuTest, ReadCurrentValue)
+{
+    EXPECT_EQ(42, rcu.current());
+    EXPECT_EQ(43, rcu.read([](int value) {
+        return value + 1;
+    }));
+}
+
+TEST_F(RcuTest, ReadUpdatedValue)
+{
+    rcu.update(std::make_unique<const int>(13));
+
+    EXPECT_EQ(13, rcu.current());
+    EXPECT_EQ(13, rcu.read(std::identity{}));
+}
+
+TEST_F(RcuTest, KeepRetiredValueWhileItIsBeingRead)
+{
+    rcu.read([this](const int& value) {
+        rcu.update(std::make_unique<const int>(13));
+        rcu.update(std::make_unique<const int>(7));
+        EXPECT_EQ(42, value);
+    });
+
+    EXPECT_EQ(7, rcu.current());
+}
+
+TEST_F(RcuTest, ReclaimRetiredValuesWhenNotRead)
+{
+    auto instances = 0;
+    {
+        auto counted = signals::Rcu<Counted>{std::make_unique<const Counted>(instances)};
+
+        for (auto i = 0; i < 3; ++i)
+            counted.update(std::make_unique<const Counted>(instances));
+
+        EXPECT_GE(2, instances);
+    }
+    EXPECT_EQ(0, instances);
+}
+
+TEST_F(RcuTest, KeepRetiredValueWhileItIsBeingReadFromAnyShard)
+{
+    auto sharded = signals::Rcu<int, 4>{std::make_unique<const int>(42)};
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        sharded.update(std::make_unique<const int>(42));
+        std::jthread{[&sharded] {
+            sharded.read([&sharded](const int& value) {
+                std::jthread{[&sharded] {
+                    sharded.update(std::make_unique<const int>(13));
+                    sharded.update(std::make_unique<const int>(7));
+                }}.join();
+                EXPECT_EQ(42, value);
+            });
+        }}.join();
+    }
+
+    EXPECT_EQ(7, sharded.current());
+}
+} // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/Results.hpp>
+#include <signals/Signal.hpp>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class ResultsTest : public Test
+{
+protected:
+    template<typename Signal>
+    void connectCounting(Signal& signal, int m)
+    {
+        signal.connect([this, m](int i) {
+            invoked.push_back(m);
+            return i * m;
+        });
+    }
+
+    std::vector<int> invoked;
+};
+
+struct FirstAboveTen
+{
+    template<typename Results>
+    int operator()(Results results) const
+    {
+        const auto found = std::ranges::find_if(results, [](int r) { return r > 10; });
+        return found == results.end() ? 0 : *found;
+    }
+};
+
+struct First
+{
+    template<typename Results>
+    std::vector<int> operator()(Results results) const
+    {
+        auto first = std::vector<int>{};
+        std::ranges::copy(results | std::views::take(1), std::back_inserter(first));
+        return first;
+    }
+};
+
+struct DereferenceTwice
+{
+    template<typename Results>
+    int operator()(Results results) const
+    {
+        auto it = results.begin();
+        return *it + *it;
+    }
+};
+
+TEST_F(ResultsTest, InvokeSlotsOnlyUntilResultIsFound)
+{
+    auto lazy = signals::Signal<int(int), signals::LazyCombiner<FirstAboveTen>>{};
+
+    for (const auto m : {1, 3, 5, 7})
+        connectCounting(lazy, m);
+
+    EXPECT_EQ(15, lazy(3));
+    EXPECT_THAT(invoked, ElementsAre(1, 3, 5));
+}
+
+TEST_F(ResultsTest, InvokeOnlyTakenSlots)
+{
+    auto lazy = signals::Signal<int(int), signals::LazyCombiner<First>>{};
+    connectCounting(lazy, 1);
+    connectCounting(lazy, -1);
+
+    EXPECT_THAT(lazy(2), ElementsAre(2));
+    EXPECT_THAT(invoked, ElementsAre(1));
+}
+
+TEST_F(ResultsTest, ReleaseTrackedObjectsOfSlotsNotInvoked)
+{
+    auto lazy = signals::Signal<int(int), signals::LazyCombiner<First>>{};
+    auto receiver = std::make_shared<int>();
+    const auto tracked = std::weak_ptr<int>{receiver};
+    connectCounting(lazy, 1);
+    lazy.connect([](int i) { return i; }, signals::track(receiver));
+
+    EXPECT_THAT(lazy(2), ElementsAre(2));
+    receiver.reset();
+    EXPECT_TRUE(tracked.expired());
+}
+
+TEST_F(ResultsTest, CacheResultForRepeatedDereference)
+{
+    auto lazy = signals::Signal<int(int), signals::LazyCombiner<DereferenceTwice>>{};
+    connectCounting(lazy, 1);
+
+    EXPECT_EQ(4, lazy(2));
+    EXPECT_THAT(invoked, ElementsAre(1));
+}
+
+TEST_F(ResultsTest, IsInputRangeOfResults)
+{
+    using Slots = std::vector<int (*)(int)>;
+    using Results = signals::Results<std::ranges::ref_view<Slots>, int>;
+
+    static_assert(std::ranges::input_range<Results>);
+    static_assert(std::ranges::view<Results>);
+    static_assert(std::is_same_v<int, std::ranges::range_value_t<Results>>);
+
+    auto slots = Slots{[](int i) { return i + 1; }, [](int i) { return i * 2; }};
+    auto argument = 3;
+    auto results = Results{std::views::all(slots), argument};
+
+    auto collected = std::vector<int>{};
+    std::ranges::copy(results, std::back_inserter(collected));
+    EXPECT_THAT(collected, ElementsAre(4, 6));
+}
+} // namespace
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/RingBuffer.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class RingBufferTest : public Test
+{
+protected:
+    signals::RingBuffer<int, 4> buffer;
+};
+
+TEST_F(RingBufferTest, IsEmptyByDefault)
+{
+    EXPECT_FALSE(buffer.tryPop());
+}
+
+TEST_F(RingBufferTest, PopInPushOrder)
+{
+    EXPECT_TRUE(buffer.tryEmplace(1));
+    EXPECT_TRUE(buffer.tryEmplace(2));
+    EXPECT_TRUE(buffer.tryEmplace(3));
+
+    EXPECT_EQ(1, buffer.tryPop());
+    EXPECT_EQ(2, buffer.tryPop());
+    EXPECT_EQ(3, buffer.tryPop());
+    EXPECT_FALSE(buffer.tryPop());
+}
+
+TEST_F(RingBufferTest, RejectPushWhenFull)
+{
+    for (auto i = 0; i < 4; ++i)
+        EXPECT_TRUE(buffer.tryEmplace(i));
+
+    EXPECT_FALSE(buffer.tryEmplace(4));
+    EXPECT_EQ(0, buffer.tryPop());
+    EXPECT_TRUE(buffer.tryEmplace(4));
+}
+
+TEST_F(RingBufferTest, ConstructValueInPlace)
+{
+    struct Point
+    {
+        Point(int x, int y) noexcept :
+            x(x),
+            y(y)
+        {
+        }
+
+        int x;
+        int y;
+    };
+
+    auto points = signals::RingBuffer<Point, 2>{};
+
+    EXPECT_TRUE(points.tryEmplace(1, 2));
+
+    const auto point = points.tryPop();
+    ASSERT_TRUE(point);
+    EXPECT_EQ(1, point->x);
+    EXPECT_EQ(2, point->y);
+}
+
+TEST_F(RingBufferTest, DestroyPendingValues)
+{
+    auto value = std::make_shared<int>(42);
+
+    {
+        auto values = signals::RingBuffer<std::shared_ptr<int>, 4>{};
+        values.tryEmplace(value);
+        values.tryEmplace(value);
+        EXPECT_EQ(3, value.use_count());
+    }
+
+    EXPECT_EQ(1, value.use_count());
+}
+
+TEST_F(RingBufferTest, PopAllValuesPushedConcurrently)
+{
+    constexpr auto producers = 4;
+    constexpr auto pushes = 1000;
+    auto values = signals::RingBuffer<int, 64>{};
+    auto threads = std::vector<std::jthread>{};
+
+    for (auto p = 0; p < producers; ++p)
+        threads.emplace_back([&values] {
+            for (auto i = 1; i <= pushes; ++i)
+                while (!values.tryEmplace(i))
+                    std::this_thread::yield();
+        });
+
+    auto sum = 0;
+
+    for (auto popped = 0; popped < producers * pushes;)
+        if (const auto value = values.tryPop(); value)
+        {
+            sum += *value;
+            ++popped;
+        }
+        else
+            std::this_thread::yield();
+
+    EXPECT_EQ(producers * pushes * (pushes + 1) / 2, sum);
+}
+
+} // namespace
@@ -22,8 +22,24 @@ public:
         isConnected = false;
     }
 
+    [[nodiscard]] bool blocked() const override
+    {
+        return blocks != 0;
+    }
+
+    void block() override
+    {
+        ++blocks;
+    }
+
+    void unblock() override
+    {
+        --blocks;
+    }
+
 private:
     bool isConnected = true;
+    int blocks = 0;
 };
 
 class ScopedConnectionTest : public Test
@@ -0,0 +1,88 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/SharedConnectionBlock.hpp>
+#include <signals/Signal.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace testing;
+
+class SharedConnectionBlockTest : public Test
+{
+protected:
+    using SharedConnectionBlock = signals::SharedConnectionBlock;
+
+    signals::Signal<void()> signal;
+    int invoked = 0;
+    signals::Connection connection = signal.connect([this] { ++invoked; });
+};
+
+TEST_F(SharedConnectionBlockTest, IsCopyableAndMoveable)
+{
+    EXPECT_TRUE(std::is_copy_constructible_v<SharedConnectionBlock>);
+    EXPECT_TRUE(std::is_copy_assignable_v<SharedConnectionBlock>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<SharedConnectionBlock>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<SharedConnectionBlock>);
+}
+
+TEST_F(SharedConnectionBlockTest, IsNotBlockingByDefault)
+{
+    EXPECT_FALSE(SharedConnectionBlock{}.blocking());
+    EXPECT_FALSE(SharedConnectionBlock{}.connection().connected());
+}
+
+TEST_F(SharedConnectionBlockTest, BlockUntilOutOfScope)
+{
+    {
+        const auto block = SharedConnectionBlock{connection};
+        EXPECT_TRUE(block.blocking());
+        EXPECT_TRUE(connection.blocked());
+
+        signal();
+        EXPECT_EQ(0, invoked);
+    }
+
+    signal();
+    EXPECT_EQ(1, invoked);
+}
+
+TEST_F(SharedConnectionBlockTest, BlockOnlyWhenBlocking)
+{
+    auto block = SharedConnectionBlock{connection, false};
+    EXPECT_FALSE(connection.blocked());
+
+    block.block();
+    block.block();
+    EXPECT_TRUE(connection.blocked());
+
+    block.unblock();
+    EXPECT_FALSE(block.blocking());
+    EXPECT_FALSE(connection.blocked());
+}
+
+TEST_F(SharedConnectionBlockTest, BlockWhileAnyBlockIsBlocking)
+{
+    auto block = SharedConnectionBlock{connection};
+    auto copy = block;
+
+    block.unblock();
+    EXPECT_TRUE(copy.blocking());
+    EXPECT_TRUE(connection.blocked());
+
+    copy.unblock();
+    EXPECT_FALSE(connection.blocked());
+}
+
+TEST_F(SharedConnectionBlockTest, TransferBlockWhenMoved)
+{
+    auto source = SharedConnectionBlock{connection};
+
+    auto target = std::move(source);
+    EXPECT_FALSE(source.blocking());
+    EXPECT_TRUE(target.blocking());
+
+    target = SharedConnectionBlock{};
+    EXPECT_FALSE(connection.blocked());
+}
+} // namespace
@@ -1,33 +1,28 @@
 // Copyright (c) 2020 Antero Nousiainen
 
+#include "Allocations.hpp"
+#include "Coroutine.hpp"
+#include "CountingResource.hpp"
+#include <signals/EventLoop.hpp>
 #include <signals/Signal.hpp>
 #include <gmock/gmock.h>
+#include <array>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
 
 namespace
 {
 using namespace testing;
 
-std::weak_ptr<std::size_t> bytesAllocated;
-
 class SignalTest : public Test
 {
 protected:
     using Signal = signals::Signal<void()>;
     using SignalWithParams = signals::Signal<void(int&)>;
 
-    void SetUp() override
-    {
-        ::bytesAllocated = bytesAllocated = std::make_shared<std::size_t>(0);
-    }
-
-    [[nodiscard]] auto measureSizeofSlot(typename Signal::Slot::Callable callable) const
-    {
-        const auto bytesBefore = *bytesAllocated;
-        auto slot = std::make_shared<Signal::Slot>(std::move(callable));
-        return *bytesAllocated - bytesBefore;
-    }
-
-    std::shared_ptr<std::size_t> bytesAllocated;
     Signal signal;
     SignalWithParams signalWithParams;
 };
@@ -116,6 +111,17 @@ TEST_F(SignalTest, IsEmptyWhenSlotsAreCleared)
     EXPECT_EQ(0, signal.num_slots());
 }
 
+TEST_F(SignalTest, DoNotConnectEmptyFunctions)
+{
+    const auto connection = signal.connect(std::function<void()>{});
+    signal.connect(signals::Function<void()>{});
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(signal.empty());
+    EXPECT_EQ(0, signal.num_slots());
+    EXPECT_NO_THROW(signal());
+}
+
 TEST_F(SignalTest, DoNothingOnSignalWhenNoSlotsAreConnected)
 {
     signal();
@@ -157,6 +163,17 @@ TEST_F(SignalTest, InvokeConnectedSlotsWithMultipleArgumentsOnSignal)
     EXPECT_EQ(42, result);
 }
 
+TEST_F(SignalTest, InvokeMoveOnlySlotsOnSignal)
+{
+    auto result = 1;
+    signal.connect([&result, factor = std::make_unique<int>(2)] {
+        result *= *factor;
+    });
+
+    signal();
+    EXPECT_EQ(2, result);
+}
+
 TEST_F(SignalTest, DoNotInvokeDisconnectedSlotOnSignal)
 {
     auto result = 1;
@@ -196,7 +213,7 @@ TEST_F(SignalTest, DoNotCrashWhenInvokedSlotConnectsNewSlot)
 
     // Having two slots connected before connecting a third one
     // should cause the slots vector to reallocate invalidating
-    // iterators causing a crash if a copy is not taken first.
+    // iterators causing a crash if the slots are iterated directly.
     signal();
 
     // While handling a signal the slots should be immutable,
@@ -207,20 +224,293 @@ TEST_F(SignalTest, DoNotCrashWhenInvokedSlotConnectsNewSlot)
     EXPECT_TRUE(slotInvoked);
 }
 
-TEST_F(SignalTest, RemoveDisconnectedSlotsBeforeConnectingNew)
+TEST_F(SignalTest, DoNotInvokeSlotsClearedDuringSignal)
+{
+    auto result = 1;
+
+    signal.connect([this, &result] {
+        signal.clear();
+        result *= 2;
+    });
+    signal.connect(add(result, 3));
+
+    signal();
+    EXPECT_EQ(2, result);
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(SignalTest, DoNotAllocateOnSignal)
+{
+    auto result = 1;
+    signal.connect(multiply(result, 2));
+    signal.connect(add(result, 3));
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    signal();
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+}
+
+signals::test::Coroutine awaitNext(
+    signals::Signal<void(int)>& signal, std::vector<int>& events)
+{
+    for (;;)
+        events.push_back(co_await signal.next());
+}
+
+signals::test::Coroutine awaitNextOn(
+    signals::Signal<void(int)>& signal, signals::Executor& executor, std::vector<int>& events)
+{
+    events.push_back(co_await signal.next(executor));
+}
+
+TEST_F(SignalTest, ResumeAwaitingCoroutineWithEventOfNextEmission)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    const auto coroutine = awaitNext(ints, events);
+
+    EXPECT_THAT(events, IsEmpty());
+
+    ints(1);
+    ints(2);
+    EXPECT_THAT(events, ElementsAre(1, 2));
+}
+
+TEST_F(SignalTest, ResumeAwaitingCoroutinesInTheOrderTheyAwaited)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    const auto first = awaitNext(ints, events);
+    const auto second = awaitNext(ints, events);
+
+    ints(1);
+    EXPECT_THAT(events, ElementsAre(1, 1));
+}
+
+TEST_F(SignalTest, DoNotAllocateWhenAwaitingNextEmission)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    events.reserve(2);
+    const auto coroutine = awaitNext(ints, events);
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    ints(1);
+    ints(2);
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+}
+
+TEST_F(SignalTest, ResumeAwaitingCoroutineOnExecutor)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto loop = signals::EventLoop{};
+    auto events = std::vector<int>{};
+    const auto coroutine = awaitNextOn(ints, loop, events);
+
+    ints(1);
+    EXPECT_THAT(events, IsEmpty());
+
+    loop.poll();
+    EXPECT_THAT(events, ElementsAre(1));
+    EXPECT_TRUE(coroutine.done());
+}
+
+TEST_F(SignalTest, DoNotResumeCoroutineDestroyedWhileAwaiting)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    {
+        const auto destroyed = awaitNext(ints, events);
+    }
+    const auto coroutine = awaitNext(ints, events);
+
+    ints(1);
+    EXPECT_THAT(events, ElementsAre(1));
+}
+
+TEST_F(SignalTest, ResumeCoroutineAwaitingMovedSignal)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    const auto coroutine = awaitNext(ints, events);
+
+    auto moved = std::move(ints);
+    ints(1);
+    moved(2);
+    EXPECT_THAT(events, ElementsAre(2));
+}
+
+TEST_F(SignalTest, ResumeAwaitingCoroutineOncePerBatchedEvent)
+{
+    auto ints = signals::Signal<void(int)>{};
+    auto events = std::vector<int>{};
+    const auto coroutine = awaitNext(ints, events);
+
+    const auto batch = std::array{1, 2, 3};
+    ints.emit_batch(batch);
+    EXPECT_THAT(events, ElementsAre(1, 2, 3));
+}
+
+template<typename Signal>
+concept Awaitable = requires(Signal& signal) { signal.next(); };
+
+class Widget
 {
-    const auto sizeofSlot = measureSizeofSlot(noop);
-    ASSERT_NE(0, sizeofSlot);
+public:
+    Widget() = default;
+
+    Widget(const Widget&) = delete;
+
+    Widget& operator=(const Widget&) = delete;
+
+    int value = 0;
+};
 
+TEST_F(SignalTest, EmitArgumentsThatCannotBeCopiedIntoEvent)
+{
+    auto widgets = signals::Signal<void(Widget&)>{};
+    auto pointers = signals::Signal<void(std::unique_ptr<int>)>{};
+    auto widget = Widget{};
+    auto sum = 0;
+    widgets.connect([](Widget& w) { ++w.value; });
+    pointers.connect([&sum](const std::unique_ptr<int>& p) { sum += *p; });
+
+    widgets(widget);
+    pointers(std::make_unique<int>(1));
+    pointers.emit_moving(std::make_unique<int>(2));
+
+    EXPECT_EQ(1, widget.value);
+    EXPECT_EQ(3, sum);
+    EXPECT_FALSE(Awaitable<decltype(widgets)>);
+    EXPECT_FALSE(Awaitable<decltype(pointers)>);
+    EXPECT_TRUE(Awaitable<signals::Signal<void(int)>>);
+}
+
+TEST_F(SignalTest, DoNotRemoveDisconnectedSlotsWhenConnectingDuringSignal)
+{
+    auto result = 1;
+    auto connection = signals::Connection{};
+
+    signal.connect([this, &connection, &result] {
+        connection.disconnect();
+        signal.connect(noop);
+        result *= 2;
+    });
+    connection = signal.connect(add(result, 3));
+    signal.connect(multiply(result, 5));
+
+    signal();
+    EXPECT_EQ(10, result);
+}
+
+TEST_F(SignalTest, ReuseDisconnectedSlotsWhenConnectingNew)
+{
     auto connection = signal.connect(noop);
     signal.connect(noop);
     connection.disconnect();
 
-    // If the disconnected slot is not removed first,
-    // the new connection will cause the slots vector to reallocate
-    const auto bytesBefore = *bytesAllocated;
+    // If the disconnected slot is not reused, the new connection
+    // will allocate a new slot and cause the slots vector to reallocate
+    const auto bytesBefore = signals::test::bytesAllocated();
+    const auto reconnected = signal.connect(noop);
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(reconnected.connected());
+    EXPECT_EQ(2, signal.num_slots());
+}
+
+TEST_F(SignalTest, DoNotDisconnectReusedSlotWithPreviousConnection)
+{
+    auto result = 1;
+    auto connection = signal.connect(noop);
+    connection.disconnect();
+    signal.connect(add(result, 3));
+
+    connection.disconnect();
+
+    signal();
+    EXPECT_EQ(4, result);
+}
+
+TEST_F(SignalTest, CountSlotsDisconnectedBeforeTheyAreRemoved)
+{
+    auto first = signal.connect(noop);
+    auto second = signal.connect(noop);
+    signal.connect(noop);
+
+    first.disconnect();
+    first.disconnect();
+    EXPECT_EQ(2, signal.num_slots());
+
+    second.disconnect();
+    EXPECT_EQ(1, signal.num_slots());
+
     signal.connect(noop);
-    EXPECT_EQ(bytesBefore + sizeofSlot, *bytesAllocated);
+    EXPECT_EQ(2, signal.num_slots());
+}
+
+TEST_F(SignalTest, DisconnectSlotsWhenDestroyed)
+{
+    auto connection = signals::Connection{};
+    {
+        auto temporary = Signal{};
+        connection = temporary.connect(noop);
+        EXPECT_TRUE(connection.connected());
+    }
+    EXPECT_FALSE(connection.connected());
+
+    connection.disconnect();
+}
+
+TEST_F(SignalTest, AllocateFromSuppliedMemoryResource)
+{
+    auto buffer = std::array<std::byte, 1024>{};
+    auto arena = std::pmr::monotonic_buffer_resource{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    auto resource = signals::test::CountingResource{&arena};
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    auto pooled = Signal{&resource};
+    auto result = 1;
+
+    auto connection = pooled.connect(multiply(result, 2));
+    pooled.connect([&result, large = std::array<int, 16>{3}] {
+        result += large[0];
+    });
+    pooled();
+    connection.disconnect();
+    pooled.connect(add(result, 1));
+    pooled();
+
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+    EXPECT_NE(0, resource.bytesAllocated);
+    EXPECT_EQ(9, result);
+}
+
+TEST_F(SignalTest, ReturnSlotsToSuppliedMemoryResourceWhenDestroyed)
+{
+    auto resource = signals::test::CountingResource{};
+    {
+        auto pooled = Signal{&resource};
+        const auto connection = pooled.connect([large = std::array<int, 16>{}] {
+            static_cast<void>(large);
+        });
+    }
+    EXPECT_EQ(0, resource.bytesInUse);
+}
+
+TEST_F(SignalTest, DisconnectWhenSignalAndItsMemoryResourceAreDestroyed)
+{
+    auto connection = signals::Connection{};
+    {
+        auto resource = std::pmr::unsynchronized_pool_resource{};
+        auto pooled = Signal{&resource};
+        connection = pooled.connect(noop);
+    }
+    EXPECT_FALSE(connection.connected());
+
+    connection.disconnect();
 }
 
 TEST_F(SignalTest, ClearSourceWhenMoved)
@@ -235,6 +525,20 @@ TEST_F(SignalTest, ClearSourceWhenMoved)
     EXPECT_FALSE(target.empty());
 }
 
+TEST_F(SignalTest, CountSlotsDisconnectedAfterMoved)
+{
+    auto source = Signal{};
+    auto connection = source.connect(noop);
+    source.connect(noop);
+
+    auto target = Signal{};
+    target = std::move(source);
+    connection.disconnect();
+
+    EXPECT_EQ(0, source.num_slots());
+    EXPECT_EQ(1, target.num_slots());
+}
+
 TEST_F(SignalTest, ClearSourceWhenMoveAssigned)
 {
     auto source = Signal{};
@@ -251,6 +555,25 @@ TEST_F(SignalTest, ClearSourceWhenMoveAssigned)
     EXPECT_FALSE(targetConnection.connected());
 }
 
+TEST_F(SignalTest, EmitSlotsMoveAssignedFromDestroyedSignalOnSameMemoryResource)
+{
+    auto resource = signals::test::CountingResource{};
+    auto result = 1;
+    {
+        auto target = Signal{&resource};
+        {
+            auto source = Signal{&resource};
+            source.connect([&result, large = std::array<int, 16>{1}] {
+                result += large[0];
+            });
+            target = std::move(source);
+        }
+        target();
+    }
+    EXPECT_EQ(2, result);
+    EXPECT_EQ(0, resource.bytesInUse);
+}
+
 TEST_F(SignalTest, IsSelfMoveSafe)
 {
     auto result = 1;
@@ -265,6 +588,46 @@ TEST_F(SignalTest, IsSelfMoveSafe)
     EXPECT_EQ(5, result);
 }
 
+TEST_F(SignalTest, StopEmittingWhenSlotDestroysSignal)
+{
+    auto owned = std::make_unique<Signal>();
+    auto invoked = 0;
+    owned->connect([&owned, &invoked] {
+        ++invoked;
+        owned.reset();
+    });
+    owned->connect([&invoked] {
+        ++invoked;
+    });
+
+    (*owned)();
+
+    EXPECT_EQ(1, invoked);
+}
+
+TEST_F(SignalTest, StopEmittingWhenSlotAssignsToSignal)
+{
+    auto invoked = 0;
+    signal.connect([this, &invoked] {
+        ++invoked;
+        signal = Signal{};
+    });
+    signal.connect([&invoked] {
+        ++invoked;
+    });
+
+    signal();
+
+    EXPECT_EQ(1, invoked);
+    EXPECT_TRUE(signal.empty());
+
+    signal.connect([&invoked] {
+        ++invoked;
+    });
+    signal();
+    EXPECT_EQ(2, invoked);
+}
+
 TEST_F(SignalTest, ReturnLastValueWhenDefaultCombinerIsUsed)
 {
     auto last = signals::Signal<int()>{};
@@ -333,13 +696,464 @@ TEST_F(SignalTest, SupportArbitraryCombinerResultType)
 
     EXPECT_THAT(collection(), ElementsAre(1, 2, 3));
 }
-} // namespace
 
-// Overridden operator new to spy on how many bytes are allocated
-void* operator new(std::size_t count)
+TEST_F(SignalTest, DoNotInvokeBlockedSlotsUntilUnblocked)
+{
+    auto result = 1;
+    auto connection = signal.connect(multiply(result, 2));
+    signal.connect(add(result, 3));
+
+    connection.block();
+    signal();
+    EXPECT_EQ(4, result);
+    EXPECT_EQ(2, signal.num_slots());
+
+    connection.unblock();
+    signal();
+    EXPECT_EQ(11, result);
+}
+
+TEST_F(SignalTest, DoNotInvokeSlotBlockedDuringSignal)
+{
+    auto values = signals::Signal<void(int)>{};
+    auto received = 0;
+    auto connection = signals::Connection{};
+    values.connect([&connection](int) { connection.block(); });
+    connection = values.connect([&received](int i) { received = i; });
+
+    values.emit_moving(1);
+    EXPECT_EQ(0, received);
+}
+
+TEST_F(SignalTest, DoNotBlockSlotReusedForNewConnection)
+{
+    auto result = 1;
+    auto connection = signal.connect(noop);
+    signal.connect(noop);
+    connection.block();
+    connection.disconnect();
+
+    const auto reconnected = signal.connect(add(result, 3));
+    connection.unblock();
+
+    signal();
+    EXPECT_FALSE(reconnected.blocked());
+    EXPECT_EQ(4, result);
+}
+
+TEST_F(SignalTest, DoNotAllocateOnBlockAndUnblock)
+{
+    auto result = 1;
+    auto connection = signal.connect(multiply(result, 2));
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    connection.block();
+    signal();
+    connection.unblock();
+    signal();
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+    EXPECT_EQ(2, result);
+}
+
+class Receiver
+{
+public:
+    void receive(int& n)
+    {
+        n += value;
+    }
+
+    int value = 0;
+};
+
+TEST_F(SignalTest, DisconnectSlotWhenTrackedObjectIsDestroyed)
+{
+    auto result = 1;
+    auto receiver = std::make_shared<Receiver>();
+    const auto connection = signal.connect(add(result, 3), signals::track(receiver));
+
+    signal();
+    EXPECT_EQ(4, result);
+
+    receiver.reset();
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(signal.empty());
+
+    signal();
+    EXPECT_EQ(4, result);
+}
+
+TEST_F(SignalTest, DoNotCountSlotWhoseTrackedObjectIsDestroyed)
+{
+    auto receiver = std::make_shared<Receiver>();
+    signal.connect([] {});
+    signal.connect([] {}, signals::track(receiver));
+
+    receiver.reset();
+    EXPECT_EQ(1, signal.num_slots());
+
+    signal.connect([] {});
+    signal();
+    EXPECT_EQ(2, signal.num_slots());
+}
+
+TEST_F(SignalTest, DisconnectSlotWhoseTrackedObjectIsDestroyed)
+{
+    auto receiver = std::make_shared<Receiver>();
+    auto connection = signal.connect([] {}, signals::track(receiver));
+
+    receiver.reset();
+    connection.disconnect();
+    EXPECT_TRUE(signal.empty());
+
+    signal.connect([] {});
+    EXPECT_EQ(1, signal.num_slots());
+}
+
+TEST_F(SignalTest, KeepTrackedObjectAliveWhileInvokingSlot)
+{
+    auto receiver = std::make_shared<Receiver>();
+    const auto tracked = std::weak_ptr<Receiver>{receiver};
+    auto alive = false;
+
+    signal.connect(
+        [&receiver, &tracked, &alive] {
+            receiver.reset();
+            alive = !tracked.expired();
+        },
+        signals::track(receiver));
+
+    signal();
+    EXPECT_TRUE(alive);
+    EXPECT_TRUE(tracked.expired());
+}
+
+TEST_F(SignalTest, DoNotInvokeSlotWhoseTrackedObjectIsDestroyedDuringSignal)
+{
+    auto result = 1;
+    auto receiver = std::make_shared<Receiver>();
+    signal.connect([&receiver] { receiver.reset(); });
+    signal.connect(add(result, 3), signals::track(receiver));
+
+    signal();
+    EXPECT_EQ(1, result);
+    EXPECT_EQ(1, signal.num_slots());
+}
+
+TEST_F(SignalTest, ReleaseTrackedObjectOfSlotBlockedAfterItWasSelected)
+{
+    auto receiver = std::make_shared<Receiver>();
+    const auto tracked = std::weak_ptr<Receiver>{receiver};
+    auto ints = signals::Signal<void(int)>{};
+    auto next = signals::Connection{};
+    ints.connect([&next](int) {
+        next.block();
+    });
+    next = ints.connect([](int) {}, signals::track(receiver));
+
+    ints.emit_moving(1);
+    receiver.reset();
+
+    EXPECT_TRUE(tracked.expired());
+}
+
+// Combiner selecting all the slots before invoking any of them
+struct SelectingCombiner
+{
+    static inline std::function<void()> selected;
+
+    template<typename Slots, typename... Args>
+    void operator()(Slots slots, Args&&... args) const
+    {
+        const auto all = std::vector<std::ranges::range_value_t<Slots>>(
+            std::ranges::begin(slots), std::ranges::end(slots));
+
+        selected();
+
+        for (const auto& slot : all)
+            std::invoke(*slot, args...);
+    }
+};
+
+TEST_F(SignalTest, KeepTrackedObjectAliveFromSelectingSlotToInvokingIt)
+{
+    auto selecting = signals::Signal<void(), SelectingCombiner>{};
+    auto receiver = std::make_shared<Receiver>();
+    auto calls = 0;
+    selecting.connect([&calls] { ++calls; }, signals::track(receiver));
+    SelectingCombiner::selected = [&receiver] {
+        receiver.reset();
+    };
+
+    selecting();
+    EXPECT_EQ(1, calls);
+
+    selecting();
+    EXPECT_EQ(1, calls);
+    EXPECT_TRUE(selecting.empty());
+
+    SelectingCombiner::selected = nullptr;
+}
+
+TEST_F(SignalTest, ConnectMemberFunctionOfTrackedObject)
+{
+    auto result = 1;
+    auto receiver = std::make_shared<Receiver>();
+    receiver->value = 2;
+
+    signalWithParams.connect<&Receiver::receive>(receiver);
+    signalWithParams(result);
+    EXPECT_EQ(3, result);
+
+    receiver.reset();
+    signalWithParams(result);
+    EXPECT_EQ(3, result);
+    EXPECT_TRUE(signalWithParams.empty());
+}
+
+TEST_F(SignalTest, InvokeSlotsInOrderOfTheirGroups)
+{
+    auto order = std::vector<int>{};
+    const auto append = [&order](int i) {
+        return [&order, i] {
+            order.push_back(i);
+        };
+    };
+
+    signal.connect(1, append(1));
+    signal.connect(append(2));
+    signal.connect(-1, append(3));
+    signal.connect(1, append(4));
+    signal.connect(0, append(5));
+
+    signal();
+    EXPECT_THAT(order, ElementsAre(3, 2, 5, 1, 4));
+}
+
+TEST_F(SignalTest, ReuseDisconnectedSlotsInOrderOfTheirGroups)
+{
+    auto result = 1;
+    auto connection = signal.connect(1, add(result, 1));
+    signal.connect(1, multiply(result, 3));
+    connection.disconnect();
+
+    signal.connect(2, add(result, 2));
+    signal.connect(0, add(result, 1));
+
+    signal();
+    EXPECT_EQ(8, result);
+}
+
+TEST_F(SignalTest, OrderSlotsConnectedDuringSignalOnceItHasFinished)
+{
+    auto result = 1;
+    signal.connect([this, &result] {
+        if (result == 1)
+            signal.connect(-1, multiply(result, 0));
+    });
+    signal.connect(1, add(result, 2));
+
+    signal();
+    EXPECT_EQ(3, result);
+
+    signal();
+    EXPECT_EQ(2, result);
+}
+
+TEST_F(SignalTest, EmitBatchToEachSlotInTurn)
+{
+    auto batched = signals::Signal<void(int)>{};
+    auto received = std::vector<int>{};
+    batched.connect([&received](int i) { received.push_back(i); });
+    batched.connect([&received](int i) { received.push_back(-i); });
+
+    batched.emit_batch(std::array{1, 2, 3});
+
+    EXPECT_THAT(received, ElementsAre(1, 2, 3, -1, -2, -3));
+}
+
+TEST_F(SignalTest, EmitBatchOnceToSlotsTakingBatch)
+{
+    auto batched = signals::Signal<void(int)>{};
+    auto batches = std::vector<std::vector<int>>{};
+    batched.connect([&batches](std::span<const int> events) {
+        batches.emplace_back(events.begin(), events.end());
+    });
+
+    batched.emit_batch(std::array{1, 2, 3});
+    batched(4);
+
+    EXPECT_THAT(batches, ElementsAre(ElementsAre(1, 2, 3), ElementsAre(4)));
+}
+
+TEST_F(SignalTest, EmitBatchWithMultipleArguments)
+{
+    auto batched = signals::Signal<void(int, const std::string&)>{};
+    auto received = std::string{};
+    batched.connect([&received](int i, const std::string& s) {
+        received += s + std::to_string(i);
+    });
+
+    using Event = decltype(batched)::Event;
+    batched.emit_batch(std::array{Event{1, "a"}, Event{2, "b"}});
+
+    EXPECT_EQ("a1b2", received);
+}
+
+TEST_F(SignalTest, DoNotEmitBatchToDisconnectedSlots)
+{
+    auto batched = signals::Signal<void(int)>{};
+    auto received = std::vector<int>{};
+    auto connection = signals::Connection{};
+    batched.connect([&](int i) {
+        if (i == 2)
+            connection.disconnect();
+    });
+    connection = batched.connect([&received](int i) { received.push_back(i); });
+    batched.connect([](std::span<const int>) {}).disconnect();
+
+    batched.emit_batch(std::array{1, 2, 3});
+
+    EXPECT_THAT(received, IsEmpty());
+}
+
+TEST_F(SignalTest, StopEmittingBatchToSlotDisconnectedDuringIt)
+{
+    auto batched = signals::Signal<void(int)>{};
+    auto received = std::vector<int>{};
+    auto connection = signals::Connection{};
+    connection = batched.connect([&](int i) {
+        received.push_back(i);
+        connection.disconnect();
+    });
+
+    batched.emit_batch(std::array{1, 2, 3});
+
+    EXPECT_THAT(received, ElementsAre(1));
+}
+
+TEST_F(SignalTest, DoNotAllocateOnEmitBatch)
+{
+    auto batched = signals::Signal<void(int)>{};
+    auto sum = 0;
+    batched.connect([&sum](int i) { sum += i; });
+    batched.connect([&sum](std::span<const int> events) {
+        for (const auto i : events)
+            sum += i;
+    });
+    const auto events = std::array{1, 2, 3};
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    batched.emit_batch(events);
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+    EXPECT_EQ(12, sum);
+}
+
+class SignalArgumentTest : public SignalTest
+{
+protected:
+    using StringSignal = signals::Signal<void(std::string)>;
+
+    std::size_t bytesToCopy(const std::string& s) const
+    {
+        const auto bytesBefore = signals::test::bytesAllocated();
+        const auto copy = s;
+        return signals::test::bytesAllocated() - bytesBefore;
+    }
+
+    const std::string payload = std::string(100, 'x');
+};
+
+TEST_F(SignalArgumentTest, DoNotCopyArgumentsForSlotsTakingConstReference)
+{
+    auto strings = StringSignal{};
+    auto received = std::size_t{0};
+
+    for (auto i = 0; i < 3; ++i)
+        strings.connect([&received](const std::string& s) { received += s.size(); });
+
+    const auto bytesBefore = signals::test::bytesAllocated();
+    strings(payload);
+    EXPECT_EQ(bytesBefore, signals::test::bytesAllocated());
+    EXPECT_EQ(300u, received);
+}
+
+TEST_F(SignalArgumentTest, CopyArgumentsOnceForEachSlotTakingValue)
+{
+    auto strings = StringSignal{};
+
+    for (auto i = 0; i < 3; ++i)
+        strings.connect([](std::string) {});
+
+    const auto bytesPerCopy = bytesToCopy(payload);
+    const auto bytesBefore = signals::test::bytesAllocated();
+    strings(payload);
+    EXPECT_EQ(bytesBefore + 3 * bytesPerCopy, signals::test::bytesAllocated());
+}
+
+TEST_F(SignalArgumentTest, ConvertArgumentsOnceForAllSlots)
 {
-    if (auto bytes = bytesAllocated.lock(); bytes)
-        *bytes += count;
+    auto strings = StringSignal{};
+
+    for (auto i = 0; i < 3; ++i)
+        strings.connect([](const std::string&) {});
 
-    return std::malloc(count);
+    const auto bytesPerCopy = bytesToCopy(payload);
+    const auto bytesBefore = signals::test::bytesAllocated();
+    strings(payload.c_str());
+    EXPECT_EQ(bytesBefore + bytesPerCopy, signals::test::bytesAllocated());
 }
+
+TEST_F(SignalArgumentTest, MoveArgumentsToLastSlotWhenEmittingMoving)
+{
+    auto strings = StringSignal{};
+    auto last = std::string{};
+
+    for (auto i = 0; i < 2; ++i)
+        strings.connect([](std::string) {});
+
+    strings.connect([&last](std::string s) { last = std::move(s); });
+
+    auto moved = payload;
+    const auto bytesPerCopy = bytesToCopy(payload);
+    const auto bytesBefore = signals::test::bytesAllocated();
+    strings.emit_moving(std::move(moved));
+    EXPECT_EQ(bytesBefore + 2 * bytesPerCopy, signals::test::bytesAllocated());
+    EXPECT_EQ(payload, last);
+}
+
+TEST_F(SignalArgumentTest, CopyLvalueArgumentsOnceWhenEmittingMoving)
+{
+    auto strings = StringSignal{};
+
+    for (auto i = 0; i < 3; ++i)
+        strings.connect([](const std::string&) {});
+
+    const auto bytesPerCopy = bytesToCopy(payload);
+    const auto bytesBefore = signals::test::bytesAllocated();
+    strings.emit_moving(payload);
+    EXPECT_EQ(bytesBefore + bytesPerCopy, signals::test::bytesAllocated());
+}
+
+TEST_F(SignalArgumentTest, ReturnResultOfLastSlotWhenEmittingMoving)
+{
+    auto strings = signals::Signal<std::string(std::string)>{};
+    strings.connect([](const std::string&) { return std::string{"first"}; });
+    strings.connect([](std::string s) { return s; });
+
+    EXPECT_EQ(payload, strings.emit_moving(std::string{payload}));
+}
+
+TEST_F(SignalArgumentTest, DoNotInvokeSlotDisconnectedDuringEmitMoving)
+{
+    auto strings = StringSignal{};
+    auto received = std::vector<std::string>{};
+    auto connection = signals::Connection{};
+    strings.connect([&](const std::string&) { connection.disconnect(); });
+    strings.connect([&received](std::string s) { received.push_back(std::move(s)); });
+    connection = strings.connect([&received](std::string s) { received.push_back(s); });
+
+    strings.emit_moving(std::string{payload});
+    EXPECT_THAT(received, ElementsAre(payload));
+}
+} // namespace
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/IntrusivePtr.hpp>
+#include <signals/SlotBase.hpp>
+#include <gtest/gtest.h>
+#include <optional>
+
+namespace
+{
+using namespace testing;
+
+class Slot : public signals::SlotBase
+{
+public:
+    explicit Slot(bool& destroyed) :
+        destroyed(destroyed)
+    {
+    }
+
+    ~Slot() override
+    {
+        destroyed = true;
+    }
+
+    // LCOV_EXCL_START
+    [[nodiscard]] bool connected() const override
+    {
+        return true;
+    }
+
+    void disconnect() override
+    {
+    }
+
+    [[nodiscard]] bool blocked() const override
+    {
+        return false;
+    }
+
+    void block() override
+    {
+    }
+
+    void unblock() override
+    {
+    }
+    // LCOV_EXCL_STOP
+
+    using SlotBase::recycle;
+
+private:
+    bool& destroyed;
+};
+
+class SlotBaseTest : public Test
+{
+protected:
+    bool destroyed = false;
+};
+
+TEST_F(SlotBaseTest, IsDisconnectable)
+{
+    EXPECT_TRUE((std::is_base_of_v<signals::Disconnectable, signals::SlotBase>));
+}
+
+TEST_F(SlotBaseTest, IsNoncopyableAndNonmoveable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<signals::SlotBase>);
+    EXPECT_FALSE(std::is_move_constructible_v<signals::SlotBase>);
+}
+
+TEST_F(SlotBaseTest, StartNewGenerationWhenRecycled)
+{
+    auto slot = Slot{destroyed};
+    const auto generation = slot.generation();
+
+    slot.recycle();
+
+    EXPECT_NE(generation, slot.generation());
+}
+
+TEST_F(SlotBaseTest, ClearReferencesWhenDestroyed)
+{
+    auto slot = std::optional<Slot>{std::in_place, destroyed};
+    const auto reference = signals::SlotBase::Reference{*slot};
+    auto copy = reference;
+    auto moved = signals::SlotBase::Reference{std::move(copy)};
+
+    EXPECT_EQ(&*slot, reference.get());
+    EXPECT_EQ(nullptr, copy.get());
+    EXPECT_EQ(&*slot, moved.get());
+
+    slot.reset();
+
+    EXPECT_EQ(nullptr, reference.get());
+    EXPECT_EQ(nullptr, moved.get());
+}
+
+TEST_F(SlotBaseTest, DestroyWhenLastReferenceIsReleased)
+{
+    auto slot = signals::IntrusivePtr<Slot>{new Slot{destroyed}};
+    auto copy = slot;
+
+    slot.reset();
+    EXPECT_FALSE(destroyed);
+
+    copy.reset();
+    EXPECT_TRUE(destroyed);
+}
+} // namespace
@@ -2,6 +2,9 @@
 
 #include <signals/Slot.hpp>
 #include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <tuple>
 
 namespace
 {
@@ -36,9 +39,9 @@ TEST_F(SlotTest, IsNonmoveable)
     EXPECT_FALSE(std::is_move_assignable_v<Slot>);
 }
 
-TEST_F(SlotTest, CallableTypeIsStdFunction)
+TEST_F(SlotTest, CallableTypeIsFunction)
 {
-    EXPECT_TRUE((std::is_same_v<std::function<int()>, Slot::Callable>));
+    EXPECT_TRUE((std::is_same_v<signals::Function<int()>, Slot::Callable>));
 }
 
 TEST_F(SlotTest, ReturnType)
@@ -47,6 +50,22 @@ TEST_F(SlotTest, ReturnType)
     EXPECT_TRUE((std::is_same_v<void, signals::Slot<void(int)>::Result>));
 }
 
+TEST_F(SlotTest, EventType)
+{
+    using Event = signals::Slot<void(int&, std::string)>::Event;
+
+    EXPECT_TRUE((std::is_same_v<std::tuple<>, Slot::Event>));
+    EXPECT_TRUE((std::is_same_v<int, signals::Slot<void(const int&)>::Event>));
+    EXPECT_TRUE((std::is_same_v<std::tuple<int, std::string>, Event>));
+}
+
+TEST_F(SlotTest, AcceptCallableTakingBatchOnlyWithoutResult)
+{
+    EXPECT_TRUE(signals::Slot<void(int)>::batched<void (*)(std::span<const int>)>);
+    EXPECT_FALSE(signals::Slot<void(int)>::batched<void (*)(int)>);
+    EXPECT_FALSE(Slot::batched<int (*)(std::span<const std::tuple<>>)>);
+}
+
 TEST_F(SlotTest, ReturnResultOfCallableWhenInvoked)
 {
     const auto result = 42;
@@ -56,4 +75,38 @@ TEST_F(SlotTest, ReturnResultOfCallableWhenInvoked)
     const auto slot = Slot{fn};
     EXPECT_EQ(result, std::invoke(slot));
 }
+
+TEST_F(SlotTest, SupportMoveOnlyCallable)
+{
+    const auto slot = Slot{[result = std::make_unique<int>(42)] {
+        return *result;
+    }};
+    EXPECT_EQ(42, std::invoke(slot));
+}
+
+TEST_F(SlotTest, KeepLockedTrackedObjectAliveUntilInvoked)
+{
+    auto object = std::make_shared<int>(42);
+    const auto tracked = std::weak_ptr<int>{object};
+    auto slot = Slot{[] { return 42; }};
+    slot.track(object);
+    EXPECT_FALSE(slot.expired());
+    EXPECT_TRUE(slot.lockTracked());
+
+    object.reset();
+    EXPECT_FALSE(slot.expired());
+    EXPECT_EQ(42, std::invoke(slot));
+    EXPECT_TRUE(tracked.expired());
+}
+
+TEST_F(SlotTest, FailToLockDestroyedTrackedObject)
+{
+    auto object = std::make_shared<int>(42);
+    auto slot = Slot{[] { return 42; }};
+    slot.track(object);
+
+    object.reset();
+    EXPECT_TRUE(slot.expired());
+    EXPECT_FALSE(slot.lockTracked());
+}
 } // namespace
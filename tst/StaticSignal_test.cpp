@@ -0,0 +1,102 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/StaticSignal.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class StaticSignalTest : public Test
+{
+};
+
+std::vector<int> received;
+
+void first(int i)
+{
+    received.push_back(i);
+}
+
+void second(int i)
+{
+    received.push_back(-i);
+}
+
+template<typename R>
+struct Collector
+{
+    template<typename Slots, typename... Args>
+    auto operator()(Slots slots, Args&&... args) const
+    {
+        auto r = R{};
+
+        for (auto& slot : slots)
+            r.push_back(std::invoke(*slot, args...));
+
+        return r;
+    }
+};
+
+TEST_F(StaticSignalTest, HasNoSlotsWithoutFunctions)
+{
+    using Empty = signals::StaticSignal<int()>;
+
+    static_assert(Empty::empty());
+    static_assert(Empty::num_slots() == 0);
+    EXPECT_EQ(0, Empty{}());
+}
+
+TEST_F(StaticSignalTest, EmitToFunctionsInOrder)
+{
+    using Signal = signals::StaticSignal<void(int), &first, &second>;
+    received.clear();
+
+    static_assert(!Signal::empty());
+    static_assert(Signal::num_slots() == 2);
+    Signal{}(1);
+    Signal{}(2);
+
+    EXPECT_THAT(received, ElementsAre(1, -1, 2, -2));
+}
+
+TEST_F(StaticSignalTest, EmitToCaptureLessLambdas)
+{
+    const auto signal =
+        signals::StaticSignal<void(int&), [](int& i) { i += 1; }, [](int& i) { i *= 10; }>{};
+    auto value = 1;
+
+    signal(value);
+
+    EXPECT_EQ(20, value);
+}
+
+TEST_F(StaticSignalTest, ReturnLastValueWhenDefaultCombinerIsUsed)
+{
+    const auto last = signals::StaticSignal<int(), [] { return 1; }, [] { return 2; }>{};
+
+    EXPECT_EQ(2, last());
+}
+
+TEST_F(StaticSignalTest, ConvertArgumentsOnceForAllSlots)
+{
+    const auto signal = signals::StaticSignal<
+        std::size_t(const std::string&), [](const std::string& s) { return s.size(); },
+        [](const std::string& s) { return s.size() * 2; }>{};
+
+    EXPECT_EQ(6, signal("abc"));
+}
+
+TEST_F(StaticSignalTest, SupportCustomResultCombiner)
+{
+    const auto collection = signals::BasicStaticSignal<
+        int(int), Collector<std::vector<int>>, [](int i) { return i; },
+        [](int i) { return i * 2; }, [](int i) { return i * 3; }>{};
+
+    EXPECT_THAT(collection(2), ElementsAre(2, 4, 6));
+}
+
+} // namespace
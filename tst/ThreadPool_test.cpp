@@ -0,0 +1,142 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <latch>
+#include <thread>
+
+namespace
+{
+using namespace testing;
+
+class ThreadPoolTest : public Test
+{
+protected:
+    using ThreadPool = signals::ThreadPool;
+};
+
+TEST_F(ThreadPoolTest, IsNoncopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible_v<ThreadPool>);
+    EXPECT_FALSE(std::is_copy_assignable_v<ThreadPool>);
+}
+
+TEST_F(ThreadPoolTest, IsExecutor)
+{
+    EXPECT_TRUE((std::is_base_of_v<signals::Executor, ThreadPool>));
+}
+
+TEST_F(ThreadPoolTest, HasThreadPerHardwareThreadByDefault)
+{
+    EXPECT_EQ(std::max(std::thread::hardware_concurrency(), 1u), ThreadPool{}.size());
+}
+
+TEST_F(ThreadPoolTest, RunPostedTask)
+{
+    auto done = std::latch{1};
+    auto id = std::thread::id{};
+    auto pool = ThreadPool{1};
+
+    pool.post([&] {
+        id = std::this_thread::get_id();
+        done.count_down();
+    });
+    done.wait();
+
+    EXPECT_NE(std::this_thread::get_id(), id);
+}
+
+TEST_F(ThreadPoolTest, RunTasksConcurrently)
+{
+    // Both tasks must be running at the same time to get past the latch
+    auto both = std::latch{2};
+    auto pool = ThreadPool{2};
+
+    pool.post([&both] { both.arrive_and_wait(); });
+    pool.post([&both] { both.arrive_and_wait(); });
+
+    both.wait();
+}
+
+TEST_F(ThreadPoolTest, HasAtLeastOneThread)
+{
+    EXPECT_EQ(1u, ThreadPool{0}.size());
+}
+
+TEST_F(ThreadPoolTest, IsSharedByWholeProgram)
+{
+    EXPECT_EQ(&ThreadPool::shared(), &ThreadPool::shared());
+}
+
+TEST_F(ThreadPoolTest, TryRunPendingTaskOnCallingThread)
+{
+    auto id = std::thread::id{};
+    auto blocked = std::latch{1};
+    auto release = std::latch{1};
+    auto pool = ThreadPool{1};
+
+    // Keep the only worker busy so that the next task stays pending
+    pool.post([&] {
+        blocked.count_down();
+        release.wait();
+    });
+    blocked.wait();
+    pool.post([&id] { id = std::this_thread::get_id(); });
+
+    EXPECT_TRUE(pool.tryRun());
+    EXPECT_EQ(std::this_thread::get_id(), id);
+    EXPECT_FALSE(pool.tryRun());
+
+    release.count_down();
+}
+
+TEST_F(ThreadPoolTest, KeepWorkingWhenTaskIsTakenByAnotherThread)
+{
+    auto pool = ThreadPool{1};
+
+    // Race the worker for the tasks so that it wakes up to find them already taken
+    for (auto i = 0; i < 1000; ++i)
+    {
+        pool.post([] {});
+        std::this_thread::yield();
+        pool.tryRun();
+    }
+
+    auto ran = std::promise<void>{};
+    pool.post([&ran] { ran.set_value(); });
+
+    EXPECT_EQ(std::future_status::ready, ran.get_future().wait_for(std::chrono::seconds{5}));
+}
+
+TEST_F(ThreadPoolTest, StealTasksPostedByBusyWorker)
+{
+    auto stolen = std::latch{1};
+    auto pool = ThreadPool{2};
+
+    // The task posted to the queue of the blocked worker can only be run by the other one
+    pool.post([&] {
+        pool.post([&stolen] { stolen.count_down(); });
+        stolen.wait();
+    });
+
+    stolen.wait();
+}
+
+TEST_F(ThreadPoolTest, RunPendingTasksOnDestruction)
+{
+    auto ran = std::atomic<int>{0};
+
+    {
+        auto pool = ThreadPool{1};
+
+        for (auto i = 0; i < 100; ++i)
+            pool.post([&ran] { ++ran; });
+    }
+
+    EXPECT_EQ(100, ran);
+}
+
+} // namespace
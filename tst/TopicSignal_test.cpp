@@ -0,0 +1,119 @@
+// Copyright (c) 2024 Antero Nousiainen
+
+#include <signals/ScopedConnection.hpp>
+#include <signals/TopicSignal.hpp>
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace testing;
+
+class TopicSignalTest : public Test
+{
+protected:
+    auto record(std::string name)
+    {
+        return [this, name = std::move(name)](double) {
+            calls.push_back(name);
+        };
+    }
+
+    signals::TopicSignal<void(double)> signal;
+    std::vector<std::string> calls;
+};
+
+TEST_F(TopicSignalTest, IsEmptyByDefault)
+{
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(TopicSignalTest, InvokesOnlyTheSlotsOfTheTopic)
+{
+    signal.connect("AAPL", record("AAPL"));
+    signal.connect("MSFT", record("MSFT"));
+
+    signal("AAPL", 1.0);
+
+    EXPECT_THAT(calls, ElementsAre("AAPL"));
+}
+
+TEST_F(TopicSignalTest, InvokesTheSlotsOfThePrefixesBeforeTheTopic)
+{
+    signal.connect("NYSE.AAPL", record("topic"));
+    signal.connect_prefix("NYSE.", record("NYSE."));
+    signal.connect_prefix("", record("all"));
+    signal.connect_prefix("NASDAQ.", record("NASDAQ."));
+    signal.connect_prefix("NYSE.AAPL.", record("too long"));
+
+    signal("NYSE.AAPL", 1.0);
+
+    EXPECT_THAT(calls, ElementsAre("all", "NYSE.", "topic"));
+}
+
+TEST_F(TopicSignalTest, PrefixMatchesTheWholeTopic)
+{
+    signal.connect_prefix("AAPL", record("AAPL"));
+
+    signal("AAPL", 1.0);
+    signal("AAP", 1.0);
+
+    EXPECT_THAT(calls, ElementsAre("AAPL"));
+}
+
+TEST_F(TopicSignalTest, DisconnectedSlotIsNotInvoked)
+{
+    auto connection = signal.connect("AAPL", record("AAPL"));
+    {
+        const signals::ScopedConnection scoped = signal.connect_prefix("A", record("A"));
+    }
+    connection.disconnect();
+
+    signal("AAPL", 1.0);
+
+    EXPECT_THAT(calls, IsEmpty());
+    EXPECT_TRUE(signal.empty());
+}
+
+TEST_F(TopicSignalTest, SlotsCanConnectToPrefixesWhileEmitting)
+{
+    signal.connect_prefix("A", [this](double) {
+        signal.connect_prefix("AA", record("AA"));
+        signal.connect_prefix("AAB", record("AAB"));
+    });
+
+    signal("AAB", 1.0);
+    signal("AAB", 1.0);
+
+    EXPECT_THAT(calls, Contains("AAB"));
+}
+
+TEST_F(TopicSignalTest, ClearDisconnectsAllSlots)
+{
+    const auto connection = signal.connect("AAPL", record("AAPL"));
+    signal.connect_prefix("", record("all"));
+
+    signal.clear();
+    signal("AAPL", 1.0);
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_TRUE(signal.empty());
+    EXPECT_THAT(calls, IsEmpty());
+}
+
+TEST_F(TopicSignalTest, SlotsCanClearTheSignalWhileEmitting)
+{
+    signal.connect_prefix("AA", [this](double) { signal.clear(); });
+    const auto connection = signal.connect("AAPL", record("AAPL"));
+
+    signal("AAPL", 1.0);
+    signal.connect("MSFT", record("MSFT"));
+    signal("AAPL", 1.0);
+    signal("MSFT", 1.0);
+
+    EXPECT_FALSE(connection.connected());
+    EXPECT_THAT(calls, ElementsAre("MSFT"));
+}
+
+} // namespace